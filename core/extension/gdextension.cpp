@@ -388,6 +388,18 @@ void GDExtension::_unregister_extension_class(GDExtensionClassLibraryPtr p_libra
 	self->extension_classes.erase(class_name);
 }
 
+void GDExtension::_register_extension_class_batch_process(GDExtensionClassLibraryPtr p_library, GDExtensionConstStringNamePtr p_class_name, GDExtensionClassBatchProcess p_process_func, GDExtensionClassBatchProcess p_physics_process_func) {
+	GDExtension *self = reinterpret_cast<GDExtension *>(p_library);
+
+	StringName class_name = *reinterpret_cast<const StringName *>(p_class_name);
+	ERR_FAIL_COND_MSG(!self->extension_classes.has(class_name), "Attempt to register batch processing for unexisting class '" + class_name + "'.");
+	ERR_FAIL_COND_MSG(!ClassDB::is_parent_class(class_name, SNAME("Node")), "Attempt to register batch processing for class '" + class_name + "', which does not inherit Node.");
+
+	Extension *extension = &self->extension_classes[class_name];
+	extension->gdextension.batch_process = p_process_func;
+	extension->gdextension.batch_physics_process = p_physics_process_func;
+}
+
 void GDExtension::_get_library_path(GDExtensionClassLibraryPtr p_library, GDExtensionStringPtr r_path) {
 	GDExtension *self = reinterpret_cast<GDExtension *>(p_library);
 
@@ -493,6 +505,7 @@ void GDExtension::initialize_gdextensions() {
 	gdextension_interface.classdb_register_extension_class_signal = _register_extension_class_signal;
 	gdextension_interface.classdb_unregister_extension_class = _unregister_extension_class;
 	gdextension_interface.get_library_path = _get_library_path;
+	gdextension_interface.classdb_register_extension_class_batch_process = _register_extension_class_batch_process;
 }
 
 Ref<Resource> GDExtensionResourceLoader::load(const String &p_path, const String &p_original_path, Error *r_error, bool p_use_sub_threads, float *r_progress, CacheMode p_cache_mode) {
@@ -246,6 +246,7 @@ typedef void (*GDExtensionClassCallVirtual)(GDExtensionClassInstancePtr p_instan
 typedef GDExtensionObjectPtr (*GDExtensionClassCreateInstance)(void *p_userdata);
 typedef void (*GDExtensionClassFreeInstance)(void *p_userdata, GDExtensionClassInstancePtr p_instance);
 typedef GDExtensionClassCallVirtual (*GDExtensionClassGetVirtual)(void *p_userdata, GDExtensionConstStringNamePtr p_name);
+typedef void (*GDExtensionClassBatchProcess)(void *p_userdata, const GDExtensionClassInstancePtr *p_instances, GDExtensionInt p_count, double p_delta);
 
 typedef struct {
 	GDExtensionBool is_virtual;
@@ -582,6 +583,11 @@ typedef struct {
 
 	void (*get_library_path)(GDExtensionClassLibraryPtr p_library, GDExtensionStringPtr r_path);
 
+	/* Opt-in batched processing for Node-derived extension classes. Once registered, processing instances of the class that have no script attached no longer receive
+	 * NOTIFICATION_PROCESS / NOTIFICATION_PHYSICS_PROCESS (nor `_process` / `_physics_process`). Instead, the callback is called once per frame with all of them,
+	 * in process order, after the other nodes of the same processing pass. Pass NULL to keep the regular per-node callbacks for either pass. */
+	void (*classdb_register_extension_class_batch_process)(GDExtensionClassLibraryPtr p_library, GDExtensionConstStringNamePtr p_class_name, GDExtensionClassBatchProcess p_process_func, GDExtensionClassBatchProcess p_physics_process_func);
+
 } GDExtensionInterface;
 
 /* INITIALIZATION */
@@ -52,6 +52,7 @@
 // and pairable_mask is either 0 if static, or set to all if non static
 
 #include "bvh_tree.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 
 #define BVHTREE_CLASS BVH_Tree<T, NUM_TREES, 2, MAX_ITEMS, USER_PAIR_TEST_FUNCTION, USER_CULL_TEST_FUNCTION, USE_PAIRS, BOUNDS, POINT>
@@ -88,6 +89,15 @@ public:
 		tree.params_set_pairing_expansion(p_value);
 	}
 
+	// When at least p_min_changed_items items changed, the pairing candidates are searched on the worker threads.
+	// Pairs are still added and removed on the calling thread in the same order as otherwise, so callbacks are
+	// sent in the same order whether this is enabled or not.
+	void params_set_threaded_pairing(bool p_enable, uint32_t p_min_changed_items = 256) {
+		BVH_LOCKED_FUNCTION
+		_threaded_pairing = p_enable;
+		_threaded_pairing_min_items = MAX(p_min_changed_items, 1u);
+	}
+
 	void set_pair_callback(PairCallback p_callback, void *p_userdata) {
 		BVH_LOCKED_FUNCTION
 		pair_callback = p_callback;
@@ -176,6 +186,18 @@ public:
 		set_tree(h, p_tree_id, p_tree_collision_mask, p_force_collision_check);
 	}
 
+	// Moves an item to another tree, keeping its collision mask. Unlike set_tree(), no collision
+	// check is done and the existing pairs are kept, so this is only correct when the item pairs
+	// with the same trees from either tree.
+	void move_to_tree(uint32_t p_handle, uint32_t p_tree_id) {
+		BVHHandle h;
+		h.set(p_handle);
+		DEV_ASSERT(!h.is_invalid());
+		BVH_LOCKED_FUNCTION
+		uint32_t tree_collision_mask = _get_extra(h).tree_collision_mask;
+		tree.item_set_tree(h, p_tree_id, tree_collision_mask);
+	}
+
 	uint32_t get_tree_id(uint32_t p_handle) const {
 		BVHHandle h;
 		h.set(p_handle);
@@ -381,6 +403,45 @@ public:
 		return params.result_count_overall;
 	}
 
+	// Same as cull_aabb() and cull_segment(), but the hits are gathered in a per-thread buffer rather than the tree's
+	// shared one, and the mutex isn't taken. Several threads can run these at once, as long as the BVH isn't
+	// modified meanwhile.
+	int cull_aabb_concurrent(const BOUNDS &p_aabb, T **p_result_array, int p_result_max, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = p_result_max;
+		params.result_array = p_result_array;
+		params.subindex_array = p_subindex_array;
+		params.tree_collision_mask = p_tree_collision_mask;
+		params.abb.from(p_aabb);
+		params.tester = p_tester;
+
+		LocalVector<uint32_t, uint32_t, true> &hits = _get_concurrent_hits();
+		tree.cull_aabb_append(params, hits);
+
+		return _translate_concurrent_hits(hits, params);
+	}
+
+	int cull_segment_concurrent(const POINT &p_from, const POINT &p_to, T **p_result_array, int p_result_max, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = p_result_max;
+		params.result_array = p_result_array;
+		params.subindex_array = p_subindex_array;
+		params.tester = p_tester;
+		params.tree_collision_mask = p_tree_collision_mask;
+
+		params.segment.from = p_from;
+		params.segment.to = p_to;
+
+		LocalVector<uint32_t, uint32_t, true> &hits = _get_concurrent_hits();
+		tree.cull_segment_append(params, hits);
+
+		return _translate_concurrent_hits(hits, params);
+	}
+
 	int cull_point(const POINT &p_point, T **p_result_array, int p_result_max, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
 		BVH_LOCKED_FUNCTION
 		typename BVHTREE_CLASS::CullParams params;
@@ -428,6 +489,24 @@ public:
 	}
 
 private:
+	static LocalVector<uint32_t, uint32_t, true> &_get_concurrent_hits() {
+		static thread_local LocalVector<uint32_t, uint32_t, true> hits;
+		hits.clear();
+		return hits;
+	}
+
+	int _translate_concurrent_hits(const LocalVector<uint32_t, uint32_t, true> &p_hits, const typename BVHTREE_CLASS::CullParams &p_params) const {
+		int count = MIN((int)p_hits.size(), p_params.result_max);
+		for (int n = 0; n < count; n++) {
+			const typename BVHTREE_CLASS::ItemExtra &ex = tree._extra[p_hits[n]];
+			p_params.result_array[n] = ex.userdata;
+			if (p_params.subindex_array) {
+				p_params.subindex_array[n] = ex.subindex;
+			}
+		}
+		return count;
+	}
+
 	// do this after moving etc.
 	void _check_for_collisions(bool p_full_check = false) {
 		if (!changed_items.size()) {
@@ -435,6 +514,11 @@ private:
 			return;
 		}
 
+		if (_threaded_pairing && changed_items.size() >= _threaded_pairing_min_items && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+			_check_for_collisions_threaded(p_full_check);
+			return;
+		}
+
 		BOUNDS bb;
 
 		typename BVHTREE_CLASS::CullParams params;
@@ -484,6 +568,80 @@ private:
 		_reset();
 	}
 
+	// Culling only reads the tree, so it can be done for all changed items at once on several threads.
+	void _find_pairing_candidates(uint32_t p_chunk, void *p_userdata) {
+		PairingChunk &chunk = _pairing_chunks[p_chunk];
+		chunk.hits.clear();
+		chunk.hit_ends.clear();
+
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = INT_MAX;
+		params.result_array = nullptr;
+		params.subindex_array = nullptr;
+
+		for (uint32_t n = chunk.first; n < chunk.first + chunk.count; n++) {
+			const BVHHandle &h = changed_items[n];
+
+			tree.item_fill_cullparams(h, params);
+			params.abb.from(tree._pairs[h.id()].expanded_aabb);
+			tree.cull_aabb_append(params, chunk.hits);
+
+			chunk.hit_ends.push_back(chunk.hits.size());
+		}
+	}
+
+	void _check_for_collisions_threaded(bool p_full_check) {
+		uint32_t item_count = changed_items.size();
+		uint32_t chunk_count = MIN(item_count, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count() * 4);
+		if (_pairing_chunks.size() < chunk_count) {
+			_pairing_chunks.resize(chunk_count);
+		}
+		for (uint32_t c = 0; c < chunk_count; c++) {
+			_pairing_chunks[c].first = (uint64_t)item_count * c / chunk_count;
+			_pairing_chunks[c].count = (uint64_t)item_count * (c + 1) / chunk_count - _pairing_chunks[c].first;
+		}
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &BVH_Manager::_find_pairing_candidates, (void *)nullptr, chunk_count, -1, true, "BVH pairing");
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		// Same as the serial path, with the culling already done.
+		for (uint32_t c = 0; c < chunk_count; c++) {
+			const PairingChunk &chunk = _pairing_chunks[c];
+			uint32_t hit_begin = 0;
+
+			for (uint32_t i = 0; i < chunk.count; i++) {
+				const BVHHandle &h = changed_items[chunk.first + i];
+
+				BVHABB_CLASS abb;
+				abb.from(tree._pairs[h.id()].expanded_aabb);
+
+				_find_leavers(h, abb, p_full_check);
+
+				uint32_t changed_item_ref_id = h.id();
+				uint32_t hit_end = chunk.hit_ends[i];
+
+				for (uint32_t j = hit_begin; j < hit_end; j++) {
+					uint32_t ref_id = chunk.hits[j];
+
+					// don't collide against ourself
+					if (ref_id == changed_item_ref_id) {
+						continue;
+					}
+
+					BVHHandle h_collidee;
+					h_collidee.set_id(ref_id);
+
+					_collide(h, h_collidee);
+				}
+
+				hit_begin = hit_end;
+			}
+		}
+		_reset();
+	}
+
 public:
 	void item_get_AABB(BVHHandle p_handle, BOUNDS &r_aabb) {
 		DEV_ASSERT(!p_handle.is_invalid());
@@ -777,6 +935,17 @@ private:
 	LocalVector<BVHHandle, uint32_t, true> changed_items;
 	uint32_t _tick = 1; // Start from 1 so items with 0 indicate never updated.
 
+	struct PairingChunk {
+		uint32_t first = 0; // Index of the first changed item.
+		uint32_t count = 0;
+		LocalVector<uint32_t, uint32_t, true> hits;
+		LocalVector<uint32_t, uint32_t, true> hit_ends; // End of the hits of each changed item.
+	};
+
+	bool _threaded_pairing = false;
+	uint32_t _threaded_pairing_min_items = 256;
+	LocalVector<PairingChunk> _pairing_chunks;
+
 	class BVHLockedFunction {
 	public:
 		BVHLockedFunction(Mutex *p_mutex, bool p_thread_safe) {
@@ -34,23 +34,112 @@
 #include "core/core_string_names.h"
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
 
 MessageQueue *MessageQueue::singleton = nullptr;
+thread_local MessageQueue::ThreadQueueOwner MessageQueue::thread_queue_owner;
+SafeNumeric<uint64_t> MessageQueue::last_id;
 
 MessageQueue *MessageQueue::get_singleton() {
 	return singleton;
 }
 
+MessageQueue::ThreadQueueOwner::~ThreadQueueOwner() {
+	// The thread is exiting. Pending messages are still flushed, unless the message queue is already gone.
+	if (queue && queue->refcount.unref()) {
+		_free_buffer(queue->buffer);
+		memdelete(queue);
+	}
+}
+
+MessageQueue::ThreadQueue *MessageQueue::_get_thread_queue() {
+	if (Thread::get_caller_id() == Thread::get_main_id()) {
+		return nullptr;
+	}
+
+	if (unlikely(thread_queue_owner.queue && thread_queue_owner.queue->message_queue_id != id)) {
+		// Registered with a message queue that was destroyed since, which already released its reference.
+		ThreadQueue *queue = thread_queue_owner.queue;
+		if (queue->refcount.unref()) {
+			_free_buffer(queue->buffer);
+			memdelete(queue);
+		}
+		thread_queue_owner.queue = nullptr;
+	}
+
+	if (unlikely(!thread_queue_owner.queue)) {
+		ThreadQueue *queue = memnew(ThreadQueue);
+		queue->refcount.init(2);
+		queue->message_queue_id = id;
+		thread_queue_owner.queue = queue;
+
+		MutexLock lock(thread_queues_mutex);
+		thread_queues.push_back(queue);
+	}
+	return thread_queue_owner.queue;
+}
+
+uint32_t MessageQueue::_get_message_size(const Message *p_message) {
+	uint32_t size = sizeof(Message);
+	if ((p_message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+		size += sizeof(Variant) * p_message->args;
+	}
+	return size;
+}
+
+void MessageQueue::_destroy_message(Message *p_message) {
+	if ((p_message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+		Variant *args = (Variant *)(p_message + 1);
+		for (int i = 0; i < p_message->args; i++) {
+			args[i].~Variant();
+		}
+	}
+	p_message->~Message();
+}
+
+void MessageQueue::_free_buffer(Buffer &p_buffer) {
+	uint32_t read_pos = 0;
+	while (read_pos < p_buffer.end) {
+		Message *message = (Message *)&p_buffer.data[read_pos];
+		read_pos += _get_message_size(message);
+		_destroy_message(message);
+	}
+	if (p_buffer.data) {
+		memfree(p_buffer.data);
+	}
+	p_buffer = Buffer();
+}
+
+MessageQueue::Message *MessageQueue::_push_message(Buffer &p_buffer, uint32_t p_room_needed, bool p_growable) {
+	if ((p_buffer.end + p_room_needed) >= p_buffer.size) {
+		if (!p_growable || p_buffer.end + p_room_needed >= buffer_size) {
+			return nullptr;
+		}
+		// Thread queues start small and grow as needed, messages are relocated along with their arguments.
+		uint32_t new_size = MAX((uint32_t)THREAD_QUEUE_INITIAL_SIZE, p_buffer.size);
+		while (p_buffer.end + p_room_needed >= new_size) {
+			new_size *= 2;
+		}
+		new_size = MIN(new_size, buffer_size);
+		p_buffer.data = (uint8_t *)memrealloc(p_buffer.data, new_size);
+		p_buffer.size = new_size;
+	}
+
+	Message *msg = memnew_placement(&p_buffer.data[p_buffer.end], Message);
+	msg->order = message_order.increment();
+	p_buffer.end += sizeof(Message);
+	return msg;
+}
+
 Error MessageQueue::push_callp(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
 	return push_callablep(Callable(p_id, p_method), p_args, p_argcount, p_show_error);
 }
 
-Error MessageQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
-	_THREAD_SAFE_METHOD_
+Error MessageQueue::_push_set(Buffer &p_buffer, bool p_growable, ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
+	Message *msg = _push_message(p_buffer, sizeof(Message) + sizeof(Variant), p_growable);
 
-	uint8_t room_needed = sizeof(Message) + sizeof(Variant);
-
-	if ((buffer_end + room_needed) >= buffer_size) {
+	if (!msg) {
 		String type;
 		if (ObjectDB::get_instance(p_id)) {
 			type = ObjectDB::get_instance(p_id)->get_class();
@@ -60,45 +149,58 @@ Error MessageQueue::push_set(ObjectID p_id, const StringName &p_prop, const Vari
 		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
 	msg->args = 1;
 	msg->callable = Callable(p_id, p_prop);
 	msg->type = TYPE_SET;
 
-	buffer_end += sizeof(Message);
-
-	Variant *v = memnew_placement(&buffer[buffer_end], Variant);
-	buffer_end += sizeof(Variant);
+	Variant *v = memnew_placement(&p_buffer.data[p_buffer.end], Variant);
+	p_buffer.end += sizeof(Variant);
 	*v = p_value;
 
 	return OK;
 }
 
-Error MessageQueue::push_notification(ObjectID p_id, int p_notification) {
-	_THREAD_SAFE_METHOD_
+Error MessageQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
+	ThreadQueue *queue = _get_thread_queue();
+	if (queue) {
+		MutexLock lock(queue->mutex);
+		return _push_set(queue->buffer, true, p_id, p_prop, p_value);
+	}
 
-	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
+	_THREAD_SAFE_METHOD_
+	return _push_set(main_buffer, false, p_id, p_prop, p_value);
+}
 
-	uint8_t room_needed = sizeof(Message);
+Error MessageQueue::_push_notification(Buffer &p_buffer, bool p_growable, ObjectID p_id, int p_notification) {
+	Message *msg = _push_message(p_buffer, sizeof(Message), p_growable);
 
-	if ((buffer_end + room_needed) >= buffer_size) {
+	if (!msg) {
 		print_line("Failed notification: " + itos(p_notification) + " target ID: " + itos(p_id));
 		statistics();
 		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
-
 	msg->type = TYPE_NOTIFICATION;
 	msg->callable = Callable(p_id, CoreStringNames::get_singleton()->notification); //name is meaningless but callable needs it
 	//msg->target;
 	msg->notification = p_notification;
 
-	buffer_end += sizeof(Message);
-
 	return OK;
 }
 
+Error MessageQueue::push_notification(ObjectID p_id, int p_notification) {
+	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
+
+	ThreadQueue *queue = _get_thread_queue();
+	if (queue) {
+		MutexLock lock(queue->mutex);
+		return _push_notification(queue->buffer, true, p_id, p_notification);
+	}
+
+	_THREAD_SAFE_METHOD_
+	return _push_notification(main_buffer, false, p_id, p_notification);
+}
+
 Error MessageQueue::push_callp(Object *p_object, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
 	return push_callp(p_object->get_instance_id(), p_method, p_args, p_argcount, p_show_error);
 }
@@ -111,18 +213,15 @@ Error MessageQueue::push_set(Object *p_object, const StringName &p_prop, const V
 	return push_set(p_object->get_instance_id(), p_prop, p_value);
 }
 
-Error MessageQueue::push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
-	_THREAD_SAFE_METHOD_
+Error MessageQueue::_push_callable(Buffer &p_buffer, bool p_growable, const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
+	Message *msg = _push_message(p_buffer, sizeof(Message) + sizeof(Variant) * p_argcount, p_growable);
 
-	int room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
-
-	if ((buffer_end + room_needed) >= buffer_size) {
+	if (!msg) {
 		print_line("Failed method: " + p_callable);
 		statistics();
 		ERR_FAIL_V_MSG(ERR_OUT_OF_MEMORY, "Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_kb' in project settings.");
 	}
 
-	Message *msg = memnew_placement(&buffer[buffer_end], Message);
 	msg->args = p_argcount;
 	msg->callable = p_callable;
 	msg->type = TYPE_CALL;
@@ -130,54 +229,58 @@ Error MessageQueue::push_callablep(const Callable &p_callable, const Variant **p
 		msg->type |= FLAG_SHOW_ERROR;
 	}
 
-	buffer_end += sizeof(Message);
-
 	for (int i = 0; i < p_argcount; i++) {
-		Variant *v = memnew_placement(&buffer[buffer_end], Variant);
-		buffer_end += sizeof(Variant);
+		Variant *v = memnew_placement(&p_buffer.data[p_buffer.end], Variant);
+		p_buffer.end += sizeof(Variant);
 		*v = *p_args[i];
 	}
 
 	return OK;
 }
 
-void MessageQueue::statistics() {
-	HashMap<StringName, int> set_count;
-	HashMap<int, int> notify_count;
-	HashMap<Callable, int> call_count;
-	int null_count = 0;
+Error MessageQueue::push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
+	ThreadQueue *queue = _get_thread_queue();
+	if (queue) {
+		MutexLock lock(queue->mutex);
+		return _push_callable(queue->buffer, true, p_callable, p_args, p_argcount, p_show_error);
+	}
+
+	_THREAD_SAFE_METHOD_
+	return _push_callable(main_buffer, false, p_callable, p_args, p_argcount, p_show_error);
+}
 
+void MessageQueue::_print_buffer_statistics(const Buffer &p_buffer, HashMap<StringName, int> &r_set_count, HashMap<int, int> &r_notify_count, HashMap<Callable, int> &r_call_count, int &r_null_count) const {
 	uint32_t read_pos = 0;
-	while (read_pos < buffer_end) {
-		Message *message = (Message *)&buffer[read_pos];
+	while (read_pos < p_buffer.end) {
+		Message *message = (Message *)&p_buffer.data[read_pos];
 
 		Object *target = message->callable.get_object();
 
 		if (target != nullptr) {
 			switch (message->type & FLAG_MASK) {
 				case TYPE_CALL: {
-					if (!call_count.has(message->callable)) {
-						call_count[message->callable] = 0;
+					if (!r_call_count.has(message->callable)) {
+						r_call_count[message->callable] = 0;
 					}
 
-					call_count[message->callable]++;
+					r_call_count[message->callable]++;
 
 				} break;
 				case TYPE_NOTIFICATION: {
-					if (!notify_count.has(message->notification)) {
-						notify_count[message->notification] = 0;
+					if (!r_notify_count.has(message->notification)) {
+						r_notify_count[message->notification] = 0;
 					}
 
-					notify_count[message->notification]++;
+					r_notify_count[message->notification]++;
 
 				} break;
 				case TYPE_SET: {
 					StringName t = message->callable.get_method();
-					if (!set_count.has(t)) {
-						set_count[t] = 0;
+					if (!r_set_count.has(t)) {
+						r_set_count[t] = 0;
 					}
 
-					set_count[t]++;
+					r_set_count[t]++;
 
 				} break;
 			}
@@ -186,16 +289,28 @@ void MessageQueue::statistics() {
 			//object was deleted
 			print_line("Object was deleted while awaiting a callback");
 
-			null_count++;
+			r_null_count++;
 		}
 
-		read_pos += sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			read_pos += sizeof(Variant) * message->args;
-		}
+		read_pos += _get_message_size(message);
+	}
+}
+
+void MessageQueue::statistics() {
+	HashMap<StringName, int> set_count;
+	HashMap<int, int> notify_count;
+	HashMap<Callable, int> call_count;
+	int null_count = 0;
+
+	// Only the queue of the calling thread is safe to inspect, besides the main one.
+	_print_buffer_statistics(main_buffer, set_count, notify_count, call_count, null_count);
+	uint32_t total_bytes = main_buffer.end;
+	if (thread_queue_owner.queue && thread_queue_owner.queue->message_queue_id == id) {
+		_print_buffer_statistics(thread_queue_owner.queue->buffer, set_count, notify_count, call_count, null_count);
+		total_bytes += thread_queue_owner.queue->buffer.end;
 	}
 
-	print_line("TOTAL BYTES: " + itos(buffer_end));
+	print_line("TOTAL BYTES: " + itos(total_bytes));
 	print_line("NULL count: " + itos(null_count));
 
 	for (const KeyValue<StringName, int> &E : set_count) {
@@ -215,6 +330,14 @@ int MessageQueue::get_max_buffer_usage() const {
 	return buffer_max_used;
 }
 
+MessageQueue::FlushStatistics MessageQueue::get_flush_statistics() const {
+	return flush_statistics;
+}
+
+void MessageQueue::reset_flush_statistics() {
+	flush_statistics = FlushStatistics();
+}
+
 void MessageQueue::_call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error) {
 	const Variant **argptrs = nullptr;
 	if (p_argcount) {
@@ -232,13 +355,35 @@ void MessageQueue::_call_function(const Callable &p_callable, const Variant *p_a
 	}
 }
 
-void MessageQueue::flush() {
-	if (buffer_end > buffer_max_used) {
-		buffer_max_used = buffer_end;
-	}
+void MessageQueue::_take_thread_buffers(LocalVector<Buffer> &r_buffers) {
+	MutexLock lock(thread_queues_mutex);
+
+	for (uint32_t i = 0; i < thread_queues.size(); i++) {
+		ThreadQueue *queue = thread_queues[i];
+		bool exited = false;
+		{
+			MutexLock queue_lock(queue->mutex);
+			if (queue->buffer.end) {
+				// The thread gets a fresh buffer, so it can keep pushing while these messages are processed.
+				r_buffers.push_back(queue->buffer);
+				queue->buffer = Buffer();
+				continue;
+			}
+			// Checked under the same lock as the buffer, so a thread can't push and exit in between.
+			exited = queue->refcount.get() == 1;
+		}
 
-	uint32_t read_pos = 0;
+		if (exited) {
+			// The thread exited and everything it queued was flushed.
+			_free_buffer(queue->buffer);
+			memdelete(queue);
+			thread_queues.remove_at_unordered(i);
+			i--;
+		}
+	}
+}
 
+void MessageQueue::flush() {
 	//using reverse locking strategy
 	_THREAD_SAFE_LOCK_
 
@@ -248,18 +393,64 @@ void MessageQueue::flush() {
 	}
 	flushing = true;
 
-	while (read_pos < buffer_end) {
+	uint64_t flush_begin = OS::get_singleton()->get_ticks_usec();
+
+	uint32_t read_pos = 0;
+	LocalVector<Buffer> thread_buffers;
+	LocalVector<uint32_t> thread_read_pos;
+	_take_thread_buffers(thread_buffers);
+	thread_read_pos.resize(thread_buffers.size());
+	for (uint32_t i = 0; i < thread_read_pos.size(); i++) {
+		thread_read_pos[i] = 0;
+	}
+
+	while (true) {
 		//lock on each iteration, so a call can re-add itself to the message queue
 
-		Message *message = (Message *)&buffer[read_pos];
+		// Process messages in the order they were pushed, whichever thread pushed them.
+		Message *message = nullptr;
+		int source = -1;
+		if (read_pos < main_buffer.end) {
+			message = (Message *)&main_buffer.data[read_pos];
+		}
+		for (uint32_t i = 0; i < thread_buffers.size(); i++) {
+			if (thread_read_pos[i] < thread_buffers[i].end) {
+				Message *thread_message = (Message *)&thread_buffers[i].data[thread_read_pos[i]];
+				if (!message || thread_message->order < message->order) {
+					message = thread_message;
+					source = i;
+				}
+			}
+		}
 
-		uint32_t advance = sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			advance += sizeof(Variant) * message->args;
+		if (!message) {
+			// Everything taken so far was processed, but threads may have queued more meanwhile.
+			for (uint32_t i = 0; i < thread_buffers.size(); i++) {
+				memfree(thread_buffers[i].data);
+			}
+			thread_buffers.clear();
+			_take_thread_buffers(thread_buffers);
+			if (thread_buffers.is_empty()) {
+				break;
+			}
+			thread_read_pos.resize(thread_buffers.size());
+			for (uint32_t i = 0; i < thread_read_pos.size(); i++) {
+				thread_read_pos[i] = 0;
+			}
+			continue;
 		}
 
+		uint32_t advance = _get_message_size(message);
+
 		//pre-advance so this function is reentrant
-		read_pos += advance;
+		if (source == -1) {
+			read_pos += advance;
+		} else {
+			thread_read_pos[source] += advance;
+		}
+
+		flush_statistics.message_count++;
+		flush_statistics.bytes += advance;
 
 		_THREAD_SAFE_UNLOCK_
 
@@ -289,19 +480,18 @@ void MessageQueue::flush() {
 			}
 		}
 
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			Variant *args = (Variant *)(message + 1);
-			for (int i = 0; i < message->args; i++) {
-				args[i].~Variant();
-			}
-		}
-
-		message->~Message();
+		_destroy_message(message);
 
 		_THREAD_SAFE_LOCK_
 	}
 
-	buffer_end = 0; // reset buffer
+	if (main_buffer.end > buffer_max_used) {
+		buffer_max_used = main_buffer.end;
+	}
+
+	flush_statistics.usec += OS::get_singleton()->get_ticks_usec() - flush_begin;
+
+	main_buffer.end = 0; // reset buffer
 	flushing = false;
 	_THREAD_SAFE_UNLOCK_
 }
@@ -313,33 +503,35 @@ bool MessageQueue::is_flushing() const {
 MessageQueue::MessageQueue() {
 	ERR_FAIL_COND_MSG(singleton != nullptr, "A MessageQueue singleton already exists.");
 	singleton = this;
+	id = last_id.increment();
 
 	buffer_size = GLOBAL_DEF_RST("memory/limits/message_queue/max_size_kb", DEFAULT_QUEUE_SIZE_KB);
 	ProjectSettings::get_singleton()->set_custom_property_info("memory/limits/message_queue/max_size_kb", PropertyInfo(Variant::INT, "memory/limits/message_queue/max_size_kb", PROPERTY_HINT_RANGE, "1024,4096,1,or_greater"));
 	buffer_size *= 1024;
-	buffer = memnew_arr(uint8_t, buffer_size);
+	main_buffer.data = memnew_arr(uint8_t, buffer_size);
+	main_buffer.size = buffer_size;
 }
 
 MessageQueue::~MessageQueue() {
 	uint32_t read_pos = 0;
 
-	while (read_pos < buffer_end) {
-		Message *message = (Message *)&buffer[read_pos];
-		Variant *args = (Variant *)(message + 1);
-		int argc = message->args;
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			for (int i = 0; i < argc; i++) {
-				args[i].~Variant();
-			}
-		}
-		message->~Message();
+	while (read_pos < main_buffer.end) {
+		Message *message = (Message *)&main_buffer.data[read_pos];
+		read_pos += _get_message_size(message);
+		_destroy_message(message);
+	}
 
-		read_pos += sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			read_pos += sizeof(Variant) * message->args;
+	for (uint32_t i = 0; i < thread_queues.size(); i++) {
+		ThreadQueue *queue = thread_queues[i];
+		{
+			MutexLock lock(queue->mutex);
+			_free_buffer(queue->buffer);
+		}
+		if (queue->refcount.unref()) {
+			memdelete(queue);
 		}
 	}
 
 	singleton = nullptr;
-	memdelete_arr(buffer);
+	memdelete_arr(main_buffer.data);
 }
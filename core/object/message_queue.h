@@ -33,6 +33,9 @@
 
 #include "core/object/object_id.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "core/variant/variant.h"
 
 class Object;
@@ -41,7 +44,8 @@ class MessageQueue {
 	_THREAD_SAFE_CLASS_
 
 	enum {
-		DEFAULT_QUEUE_SIZE_KB = 4096
+		DEFAULT_QUEUE_SIZE_KB = 4096,
+		THREAD_QUEUE_INITIAL_SIZE = 4096
 	};
 
 	enum {
@@ -55,6 +59,7 @@ class MessageQueue {
 
 	struct Message {
 		Callable callable;
+		uint64_t order = 0; // Global push order, used to merge the queues of all threads when flushing.
 		int16_t type;
 		union {
 			int16_t notification;
@@ -62,11 +67,61 @@ class MessageQueue {
 		};
 	};
 
-	uint8_t *buffer = nullptr;
-	uint32_t buffer_end = 0;
+	struct Buffer {
+		uint8_t *data = nullptr;
+		uint32_t end = 0;
+		uint32_t size = 0;
+	};
+
+	// Messages pushed from threads other than the main one go to a queue owned by that thread,
+	// so threads don't contend with each other nor with the main thread when deferring calls.
+	struct ThreadQueue {
+		BinaryMutex mutex;
+		Buffer buffer;
+		SafeRefCount refcount; // Referenced by the owning thread and by the message queue.
+		uint64_t message_queue_id = 0; // Threads outlive message queues, so the queue is registered again with a new one.
+	};
+
+	struct ThreadQueueOwner {
+		ThreadQueue *queue = nullptr;
+		~ThreadQueueOwner();
+	};
+
+	static thread_local ThreadQueueOwner thread_queue_owner;
+	static SafeNumeric<uint64_t> last_id;
+
+	uint64_t id = 0;
+
+	Buffer main_buffer;
 	uint32_t buffer_max_used = 0;
 	uint32_t buffer_size = 0;
 
+	BinaryMutex thread_queues_mutex;
+	LocalVector<ThreadQueue *> thread_queues;
+	SafeNumeric<uint64_t> message_order;
+
+public:
+	struct FlushStatistics {
+		uint32_t message_count = 0;
+		uint64_t bytes = 0;
+		uint64_t usec = 0;
+	};
+
+private:
+	FlushStatistics flush_statistics;
+
+	ThreadQueue *_get_thread_queue();
+	Message *_push_message(Buffer &p_buffer, uint32_t p_room_needed, bool p_growable);
+	Error _push_set(Buffer &p_buffer, bool p_growable, ObjectID p_id, const StringName &p_prop, const Variant &p_value);
+	Error _push_notification(Buffer &p_buffer, bool p_growable, ObjectID p_id, int p_notification);
+	Error _push_callable(Buffer &p_buffer, bool p_growable, const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error);
+	void _take_thread_buffers(LocalVector<Buffer> &r_buffers);
+	void _print_buffer_statistics(const Buffer &p_buffer, HashMap<StringName, int> &r_set_count, HashMap<int, int> &r_notify_count, HashMap<Callable, int> &r_call_count, int &r_null_count) const;
+
+	static uint32_t _get_message_size(const Message *p_message);
+	static void _destroy_message(Message *p_message);
+	static void _free_buffer(Buffer &p_buffer);
+
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
 	static MessageQueue *singleton;
@@ -122,6 +177,10 @@ public:
 
 	int get_max_buffer_usage() const;
 
+	// Accumulated over all flushes since the last reset.
+	FlushStatistics get_flush_statistics() const;
+	void reset_flush_statistics();
+
 	MessageQueue();
 	~MessageQueue();
 };
@@ -91,6 +91,11 @@ void Array::_unref() const {
 	_p = nullptr;
 }
 
+// True when the value can be stored as-is, without type validation or conversion.
+static _FORCE_INLINE_ bool _is_exact_element_type(const ContainerTypeValidate &p_typed, const Variant &p_value) {
+	return p_typed.type == Variant::NIL || (p_typed.type == p_value.get_type() && p_typed.type != Variant::OBJECT);
+}
+
 Variant &Array::operator[](int p_idx) {
 	if (unlikely(_p->read_only)) {
 		*_p->read_only = _p->array[p_idx];
@@ -261,6 +266,10 @@ void Array::operator=(const Array &p_array) {
 
 void Array::push_back(const Variant &p_value) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
+	if (_is_exact_element_type(_p->typed, p_value)) {
+		_p->array.push_back(p_value);
+		return;
+	}
 	Variant value = p_value;
 	ERR_FAIL_COND(!_p->typed.validate(value, "push_back"));
 	_p->array.push_back(value);
@@ -397,6 +406,10 @@ void Array::remove_at(int p_pos) {
 
 void Array::set(int p_idx, const Variant &p_value) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
+	if (_is_exact_element_type(_p->typed, p_value)) {
+		operator[](p_idx) = p_value;
+		return;
+	}
 	Variant value = p_value;
 	ERR_FAIL_COND(!_p->typed.validate(value, "set"));
 
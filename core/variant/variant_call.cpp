@@ -656,6 +656,23 @@ static _FORCE_INLINE_ void vc_ptrcall(void (*method)(T *, P...), void *p_base, c
 		}                                                                                                                                                         \
 	};
 
+// Scalar type used by the bulk packed array operations: the element type itself for float arrays,
+// real_t for vector arrays.
+template <class T>
+struct PackedArrayScalar {
+	typedef real_t Type;
+};
+
+template <>
+struct PackedArrayScalar<float> {
+	typedef float Type;
+};
+
+template <>
+struct PackedArrayScalar<double> {
+	typedef double Type;
+};
+
 struct _VariantCall {
 	static String func_PackedByteArray_get_string_from_ascii(PackedByteArray *p_instance) {
 		String s;
@@ -1004,6 +1021,241 @@ struct _VariantCall {
 		return len;
 	}
 
+	// Bulk operations on packed arrays. They work on the raw buffers in tight loops that the compiler
+	// can vectorize, reductions use several independent accumulators for the same reason.
+
+	template <class T>
+	static double func_PackedFloatArray_sum(Vector<T> *p_instance) {
+		const T *r = p_instance->ptr();
+		const int64_t size = p_instance->size();
+		double acc[4] = { 0.0, 0.0, 0.0, 0.0 };
+		int64_t i = 0;
+		for (; i + 4 <= size; i += 4) {
+			acc[0] += r[i];
+			acc[1] += r[i + 1];
+			acc[2] += r[i + 2];
+			acc[3] += r[i + 3];
+		}
+		for (; i < size; i++) {
+			acc[0] += r[i];
+		}
+		return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+	}
+
+	template <class T>
+	static double func_PackedFloatArray_dot(Vector<T> *p_instance, const Vector<T> &p_with) {
+		const int64_t size = p_instance->size();
+		ERR_FAIL_COND_V_MSG(size != p_with.size(), 0.0, "Both arrays must have the same size.");
+		const T *a = p_instance->ptr();
+		const T *b = p_with.ptr();
+		double acc[4] = { 0.0, 0.0, 0.0, 0.0 };
+		int64_t i = 0;
+		for (; i + 4 <= size; i += 4) {
+			acc[0] += (double)a[i] * b[i];
+			acc[1] += (double)a[i + 1] * b[i + 1];
+			acc[2] += (double)a[i + 2] * b[i + 2];
+			acc[3] += (double)a[i + 3] * b[i + 3];
+		}
+		for (; i < size; i++) {
+			acc[0] += (double)a[i] * b[i];
+		}
+		return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+	}
+
+	template <class T>
+	static double func_PackedFloatArray_min(Vector<T> *p_instance) {
+		const int64_t size = p_instance->size();
+		if (size == 0) {
+			return 0.0;
+		}
+		const T *r = p_instance->ptr();
+		T result = r[0];
+		for (int64_t i = 1; i < size; i++) {
+			result = r[i] < result ? r[i] : result;
+		}
+		return result;
+	}
+
+	template <class T>
+	static double func_PackedFloatArray_max(Vector<T> *p_instance) {
+		const int64_t size = p_instance->size();
+		if (size == 0) {
+			return 0.0;
+		}
+		const T *r = p_instance->ptr();
+		T result = r[0];
+		for (int64_t i = 1; i < size; i++) {
+			result = r[i] > result ? r[i] : result;
+		}
+		return result;
+	}
+
+	template <class T>
+	static void func_PackedFloatArray_multiply_add(Vector<T> *p_instance, double p_factor, double p_offset) {
+		const int64_t size = p_instance->size();
+		if (size == 0) {
+			return;
+		}
+		T *w = p_instance->ptrw();
+		const T factor = p_factor;
+		const T offset = p_offset;
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = w[i] * factor + offset;
+		}
+	}
+
+	template <class T>
+	static void func_PackedFloatArray_clamp(Vector<T> *p_instance, double p_min, double p_max) {
+		const int64_t size = p_instance->size();
+		if (size == 0) {
+			return;
+		}
+		T *w = p_instance->ptrw();
+		const T min = p_min;
+		const T max = p_max;
+		for (int64_t i = 0; i < size; i++) {
+			const T v = w[i] < min ? min : w[i];
+			w[i] = v > max ? max : v;
+		}
+	}
+
+	template <class T>
+	static void func_PackedFloatArray_prefix_sum(Vector<T> *p_instance) {
+		const int64_t size = p_instance->size();
+		if (size == 0) {
+			return;
+		}
+		T *w = p_instance->ptrw();
+		for (int64_t i = 1; i < size; i++) {
+			w[i] += w[i - 1];
+		}
+	}
+
+	template <class T>
+	static void func_PackedArray_add(Vector<T> *p_instance, const T &p_value) {
+		const int64_t size = p_instance->size();
+		if (size == 0) {
+			return;
+		}
+		T *w = p_instance->ptrw();
+		const T value = p_value;
+		for (int64_t i = 0; i < size; i++) {
+			w[i] += value;
+		}
+	}
+
+	template <class T>
+	static void func_PackedArray_multiply(Vector<T> *p_instance, double p_factor) {
+		const int64_t size = p_instance->size();
+		if (size == 0) {
+			return;
+		}
+		T *w = p_instance->ptrw();
+		const typename PackedArrayScalar<T>::Type factor = p_factor;
+		for (int64_t i = 0; i < size; i++) {
+			w[i] *= factor;
+		}
+	}
+
+	template <class T>
+	static void func_PackedArray_add_array(Vector<T> *p_instance, const Vector<T> &p_array) {
+		const int64_t size = p_instance->size();
+		ERR_FAIL_COND_MSG(size != p_array.size(), "Both arrays must have the same size.");
+		if (size == 0) {
+			return;
+		}
+		T *w = p_instance->ptrw();
+		const T *r = p_array.ptr();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] += r[i];
+		}
+	}
+
+	template <class T>
+	static void func_PackedArray_multiply_array(Vector<T> *p_instance, const Vector<T> &p_array) {
+		const int64_t size = p_instance->size();
+		ERR_FAIL_COND_MSG(size != p_array.size(), "Both arrays must have the same size.");
+		if (size == 0) {
+			return;
+		}
+		T *w = p_instance->ptrw();
+		const T *r = p_array.ptr();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] *= r[i];
+		}
+	}
+
+	template <class T>
+	static void func_PackedArray_lerp(Vector<T> *p_instance, const Vector<T> &p_to, double p_weight) {
+		const int64_t size = p_instance->size();
+		ERR_FAIL_COND_MSG(size != p_to.size(), "Both arrays must have the same size.");
+		if (size == 0) {
+			return;
+		}
+		T *w = p_instance->ptrw();
+		const T *r = p_to.ptr();
+		const typename PackedArrayScalar<T>::Type weight = p_weight;
+		for (int64_t i = 0; i < size; i++) {
+			w[i] += (r[i] - w[i]) * weight;
+		}
+	}
+
+	template <class T>
+	static T func_PackedVectorArray_sum(Vector<T> *p_instance) {
+		const int64_t size = p_instance->size();
+		const T *r = p_instance->ptr();
+		T acc[2];
+		int64_t i = 0;
+		for (; i + 2 <= size; i += 2) {
+			acc[0] += r[i];
+			acc[1] += r[i + 1];
+		}
+		for (; i < size; i++) {
+			acc[0] += r[i];
+		}
+		return acc[0] + acc[1];
+	}
+
+	template <class T>
+	static Vector<T> func_PackedArray_gather(Vector<T> *p_instance, const PackedInt32Array &p_indices) {
+		Vector<T> dest;
+		const int64_t count = p_indices.size();
+		if (count == 0) {
+			return dest;
+		}
+		const int64_t size = p_instance->size();
+		const int32_t *idx = p_indices.ptr();
+		for (int64_t i = 0; i < count; i++) {
+			ERR_FAIL_INDEX_V_MSG(idx[i], size, Vector<T>(), "Gather index out of bounds.");
+		}
+		dest.resize(count);
+		T *w = dest.ptrw();
+		const T *r = p_instance->ptr();
+		for (int64_t i = 0; i < count; i++) {
+			w[i] = r[idx[i]];
+		}
+		return dest;
+	}
+
+	template <class T>
+	static void func_PackedArray_scatter(Vector<T> *p_instance, const PackedInt32Array &p_indices, const Vector<T> &p_values) {
+		const int64_t count = p_indices.size();
+		ERR_FAIL_COND_MSG(count != p_values.size(), "Indices and values must have the same size.");
+		if (count == 0) {
+			return;
+		}
+		const int64_t size = p_instance->size();
+		const int32_t *idx = p_indices.ptr();
+		for (int64_t i = 0; i < count; i++) {
+			ERR_FAIL_INDEX_MSG(idx[i], size, "Scatter index out of bounds.");
+		}
+		T *w = p_instance->ptrw();
+		const T *r = p_values.ptr();
+		for (int64_t i = 0; i < count; i++) {
+			w[idx[i]] = r[i];
+		}
+	}
+
 	static void func_Callable_call(Variant *v, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
 		Callable *callable = VariantGetInternalPtr<Callable>::get_ptr(v);
 		callable->callp(p_args, p_argcount, r_ret, r_error);
@@ -2362,6 +2614,21 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedFloat32Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat32Array, count, sarray("value"), varray());
 
+	bind_function(PackedFloat32Array, sum, _VariantCall::func_PackedFloatArray_sum<float>, sarray(), varray());
+	bind_function(PackedFloat32Array, dot, _VariantCall::func_PackedFloatArray_dot<float>, sarray("with"), varray());
+	bind_function(PackedFloat32Array, min, _VariantCall::func_PackedFloatArray_min<float>, sarray(), varray());
+	bind_function(PackedFloat32Array, max, _VariantCall::func_PackedFloatArray_max<float>, sarray(), varray());
+	bind_functionnc(PackedFloat32Array, add, _VariantCall::func_PackedArray_add<float>, sarray("value"), varray());
+	bind_functionnc(PackedFloat32Array, add_array, _VariantCall::func_PackedArray_add_array<float>, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, multiply, _VariantCall::func_PackedArray_multiply<float>, sarray("factor"), varray());
+	bind_functionnc(PackedFloat32Array, multiply_array, _VariantCall::func_PackedArray_multiply_array<float>, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, multiply_add, _VariantCall::func_PackedFloatArray_multiply_add<float>, sarray("factor", "offset"), varray());
+	bind_functionnc(PackedFloat32Array, clamp, _VariantCall::func_PackedFloatArray_clamp<float>, sarray("min", "max"), varray());
+	bind_functionnc(PackedFloat32Array, lerp, _VariantCall::func_PackedArray_lerp<float>, sarray("to", "weight"), varray());
+	bind_functionnc(PackedFloat32Array, prefix_sum, _VariantCall::func_PackedFloatArray_prefix_sum<float>, sarray(), varray());
+	bind_function(PackedFloat32Array, gather, _VariantCall::func_PackedArray_gather<float>, sarray("indices"), varray());
+	bind_functionnc(PackedFloat32Array, scatter, _VariantCall::func_PackedArray_scatter<float>, sarray("indices", "values"), varray());
+
 	/* Float64 Array */
 
 	bind_method(PackedFloat64Array, size, sarray(), varray());
@@ -2386,6 +2653,21 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedFloat64Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat64Array, count, sarray("value"), varray());
 
+	bind_function(PackedFloat64Array, sum, _VariantCall::func_PackedFloatArray_sum<double>, sarray(), varray());
+	bind_function(PackedFloat64Array, dot, _VariantCall::func_PackedFloatArray_dot<double>, sarray("with"), varray());
+	bind_function(PackedFloat64Array, min, _VariantCall::func_PackedFloatArray_min<double>, sarray(), varray());
+	bind_function(PackedFloat64Array, max, _VariantCall::func_PackedFloatArray_max<double>, sarray(), varray());
+	bind_functionnc(PackedFloat64Array, add, _VariantCall::func_PackedArray_add<double>, sarray("value"), varray());
+	bind_functionnc(PackedFloat64Array, add_array, _VariantCall::func_PackedArray_add_array<double>, sarray("array"), varray());
+	bind_functionnc(PackedFloat64Array, multiply, _VariantCall::func_PackedArray_multiply<double>, sarray("factor"), varray());
+	bind_functionnc(PackedFloat64Array, multiply_array, _VariantCall::func_PackedArray_multiply_array<double>, sarray("array"), varray());
+	bind_functionnc(PackedFloat64Array, multiply_add, _VariantCall::func_PackedFloatArray_multiply_add<double>, sarray("factor", "offset"), varray());
+	bind_functionnc(PackedFloat64Array, clamp, _VariantCall::func_PackedFloatArray_clamp<double>, sarray("min", "max"), varray());
+	bind_functionnc(PackedFloat64Array, lerp, _VariantCall::func_PackedArray_lerp<double>, sarray("to", "weight"), varray());
+	bind_functionnc(PackedFloat64Array, prefix_sum, _VariantCall::func_PackedFloatArray_prefix_sum<double>, sarray(), varray());
+	bind_function(PackedFloat64Array, gather, _VariantCall::func_PackedArray_gather<double>, sarray("indices"), varray());
+	bind_functionnc(PackedFloat64Array, scatter, _VariantCall::func_PackedArray_scatter<double>, sarray("indices", "values"), varray());
+
 	/* String Array */
 
 	bind_method(PackedStringArray, size, sarray(), varray());
@@ -2434,6 +2716,15 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedVector2Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector2Array, count, sarray("value"), varray());
 
+	bind_function(PackedVector2Array, sum, _VariantCall::func_PackedVectorArray_sum<Vector2>, sarray(), varray());
+	bind_functionnc(PackedVector2Array, add, _VariantCall::func_PackedArray_add<Vector2>, sarray("value"), varray());
+	bind_functionnc(PackedVector2Array, add_array, _VariantCall::func_PackedArray_add_array<Vector2>, sarray("array"), varray());
+	bind_functionnc(PackedVector2Array, multiply, _VariantCall::func_PackedArray_multiply<Vector2>, sarray("factor"), varray());
+	bind_functionnc(PackedVector2Array, multiply_array, _VariantCall::func_PackedArray_multiply_array<Vector2>, sarray("array"), varray());
+	bind_functionnc(PackedVector2Array, lerp, _VariantCall::func_PackedArray_lerp<Vector2>, sarray("to", "weight"), varray());
+	bind_function(PackedVector2Array, gather, _VariantCall::func_PackedArray_gather<Vector2>, sarray("indices"), varray());
+	bind_functionnc(PackedVector2Array, scatter, _VariantCall::func_PackedArray_scatter<Vector2>, sarray("indices", "values"), varray());
+
 	/* Vector3 Array */
 
 	bind_method(PackedVector3Array, size, sarray(), varray());
@@ -2458,6 +2749,15 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedVector3Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector3Array, count, sarray("value"), varray());
 
+	bind_function(PackedVector3Array, sum, _VariantCall::func_PackedVectorArray_sum<Vector3>, sarray(), varray());
+	bind_functionnc(PackedVector3Array, add, _VariantCall::func_PackedArray_add<Vector3>, sarray("value"), varray());
+	bind_functionnc(PackedVector3Array, add_array, _VariantCall::func_PackedArray_add_array<Vector3>, sarray("array"), varray());
+	bind_functionnc(PackedVector3Array, multiply, _VariantCall::func_PackedArray_multiply<Vector3>, sarray("factor"), varray());
+	bind_functionnc(PackedVector3Array, multiply_array, _VariantCall::func_PackedArray_multiply_array<Vector3>, sarray("array"), varray());
+	bind_functionnc(PackedVector3Array, lerp, _VariantCall::func_PackedArray_lerp<Vector3>, sarray("to", "weight"), varray());
+	bind_function(PackedVector3Array, gather, _VariantCall::func_PackedArray_gather<Vector3>, sarray("indices"), varray());
+	bind_functionnc(PackedVector3Array, scatter, _VariantCall::func_PackedArray_scatter<Vector3>, sarray("indices", "values"), varray());
+
 	/* Color Array */
 
 	bind_method(PackedColorArray, size, sarray(), varray());
@@ -397,6 +397,10 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("  --debug-paths                     Show path lines when running the scene.\n");
 	OS::get_singleton()->print("  --debug-navigation                Show navigation polygons when running the scene.\n");
 	OS::get_singleton()->print("  --debug-stringnames               Print all StringName allocations to stdout when the engine quits.\n");
+#ifdef MODULE_GDSCRIPT_ENABLED
+	OS::get_singleton()->print("  --gdscript-sample-profile=<file>  Sample GDScript call stacks and save them as folded stacks (flame graph input) to <file> when the engine quits.\n");
+	OS::get_singleton()->print("  --gdscript-sample-rate=<hz>       Samples per second taken by --gdscript-sample-profile (default: 1000).\n");
+#endif
 #endif
 	OS::get_singleton()->print("  --frame-delay <ms>                Simulate high CPU load (delay each frame by <ms> milliseconds).\n");
 	OS::get_singleton()->print("  --time-scale <scale>              Force time scale (higher values are faster, 1.0 is normal speed).\n");
@@ -3101,6 +3105,7 @@ bool Main::is_iterating() {
 // For performance metrics.
 static uint64_t physics_process_max = 0;
 static uint64_t process_max = 0;
+static MessageQueue::FlushStatistics message_queue_max;
 
 bool Main::iteration() {
 	//for now do not error on this
@@ -3213,6 +3218,13 @@ bool Main::iteration() {
 
 	process_ticks = OS::get_singleton()->get_ticks_usec() - process_begin;
 	process_max = MAX(process_ticks, process_max);
+
+	MessageQueue::FlushStatistics message_queue_frame = message_queue->get_flush_statistics();
+	message_queue->reset_flush_statistics();
+	message_queue_max.message_count = MAX(message_queue_frame.message_count, message_queue_max.message_count);
+	message_queue_max.bytes = MAX(message_queue_frame.bytes, message_queue_max.bytes);
+	message_queue_max.usec = MAX(message_queue_frame.usec, message_queue_max.usec);
+
 	uint64_t frame_time = OS::get_singleton()->get_ticks_usec() - ticks;
 
 	for (int i = 0; i < ScriptServer::get_language_count(); i++) {
@@ -3245,8 +3257,10 @@ bool Main::iteration() {
 		Engine::get_singleton()->_fps = frames;
 		performance->set_process_time(USEC_TO_SEC(process_max));
 		performance->set_physics_process_time(USEC_TO_SEC(physics_process_max));
+		performance->set_message_queue_statistics(message_queue_max.message_count, message_queue_max.bytes, USEC_TO_SEC(message_queue_max.usec));
 		process_max = 0;
 		physics_process_max = 0;
+		message_queue_max = MessageQueue::FlushStatistics();
 
 		frame %= 1000000;
 		frames = 0;
@@ -74,13 +74,26 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PHYSICS_3D_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(PHYSICS_3D_ISLAND_COUNT);
 	BIND_ENUM_CONSTANT(AUDIO_OUTPUT_LATENCY);
+	BIND_ENUM_CONSTANT(OBJECT_GET_NODE_CALLS);
+	BIND_ENUM_CONSTANT(OBJECT_GET_NODE_MISSES);
+	BIND_ENUM_CONSTANT(MESSAGE_QUEUE_MESSAGES);
+	BIND_ENUM_CONSTANT(MESSAGE_QUEUE_BYTES);
+	BIND_ENUM_CONSTANT(MESSAGE_QUEUE_FLUSH_TIME);
+	BIND_ENUM_CONSTANT(TIME_SLICED_JOBS);
+	BIND_ENUM_CONSTANT(TIME_SLICE_USAGE);
+	BIND_ENUM_CONSTANT(TIME_SLICE_OVERRUNS);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_SLEEPING_OBJECTS);
 
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
-int Performance::_get_node_count() const {
+SceneTree *Performance::_get_scene_tree() const {
 	MainLoop *ml = OS::get_singleton()->get_main_loop();
-	SceneTree *sml = Object::cast_to<SceneTree>(ml);
+	return Object::cast_to<SceneTree>(ml);
+}
+
+int Performance::_get_node_count() const {
+	SceneTree *sml = _get_scene_tree();
 	if (!sml) {
 		return 0;
 	}
@@ -113,6 +126,15 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"physics_3d/collision_pairs",
 		"physics_3d/islands",
 		"audio/driver/output_latency",
+		"object/get_node_calls",
+		"object/get_node_misses",
+		"message_queue/messages",
+		"message_queue/bytes",
+		"message_queue/flush_time",
+		"time_slice/jobs",
+		"time_slice/usage",
+		"time_slice/overruns",
+		"physics_3d/sleeping_objects",
 
 	};
 
@@ -167,6 +189,30 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_ISLAND_COUNT);
 		case AUDIO_OUTPUT_LATENCY:
 			return AudioServer::get_singleton()->get_output_latency();
+		case OBJECT_GET_NODE_CALLS:
+			return Node::get_node_call_count.get();
+		case OBJECT_GET_NODE_MISSES:
+			return Node::get_node_miss_count.get();
+		case MESSAGE_QUEUE_MESSAGES:
+			return _message_queue_messages;
+		case MESSAGE_QUEUE_BYTES:
+			return _message_queue_bytes;
+		case MESSAGE_QUEUE_FLUSH_TIME:
+			return _message_queue_flush_time;
+		case TIME_SLICED_JOBS: {
+			SceneTree *sml = _get_scene_tree();
+			return sml ? sml->get_time_sliced_job_count() : 0;
+		}
+		case TIME_SLICE_USAGE: {
+			SceneTree *sml = _get_scene_tree();
+			return sml ? USEC_TO_SEC(sml->get_time_slice_usage_usec()) : 0;
+		}
+		case TIME_SLICE_OVERRUNS: {
+			SceneTree *sml = _get_scene_tree();
+			return sml ? sml->get_time_slice_overrun_count() : 0;
+		}
+		case PHYSICS_3D_SLEEPING_OBJECTS:
+			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_SLEEPING_OBJECTS);
 
 		default: {
 		}
@@ -202,6 +248,15 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
 
 	};
 
@@ -216,6 +271,12 @@ void Performance::set_physics_process_time(double p_pt) {
 	_physics_process_time = p_pt;
 }
 
+void Performance::set_message_queue_statistics(uint64_t p_messages, uint64_t p_bytes, double p_flush_time) {
+	_message_queue_messages = p_messages;
+	_message_queue_bytes = p_bytes;
+	_message_queue_flush_time = p_flush_time;
+}
+
 void Performance::add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args) {
 	ERR_FAIL_COND_MSG(has_custom_monitor(p_id), "Custom monitor with id '" + String(p_id) + "' already exists.");
 	_monitor_map.insert(p_id, MonitorCall(p_callable, p_args));
@@ -262,6 +323,9 @@ uint64_t Performance::get_monitor_modification_time() {
 Performance::Performance() {
 	_process_time = 0;
 	_physics_process_time = 0;
+	_message_queue_messages = 0;
+	_message_queue_bytes = 0;
+	_message_queue_flush_time = 0;
 	_monitor_modification_time = 0;
 	singleton = this;
 }
@@ -37,6 +37,8 @@
 #define PERF_WARN_OFFLINE_FUNCTION
 #define PERF_WARN_PROCESS_SYNC
 
+class SceneTree;
+
 template <typename T>
 class TypedArray;
 
@@ -46,10 +48,14 @@ class Performance : public Object {
 	static Performance *singleton;
 	static void _bind_methods();
 
+	SceneTree *_get_scene_tree() const;
 	int _get_node_count() const;
 
 	double _process_time;
 	double _physics_process_time;
+	uint64_t _message_queue_messages;
+	uint64_t _message_queue_bytes;
+	double _message_queue_flush_time;
 
 	class MonitorCall {
 		Callable _callable;
@@ -89,6 +95,15 @@ public:
 		PHYSICS_3D_COLLISION_PAIRS,
 		PHYSICS_3D_ISLAND_COUNT,
 		AUDIO_OUTPUT_LATENCY,
+		OBJECT_GET_NODE_CALLS,
+		OBJECT_GET_NODE_MISSES,
+		MESSAGE_QUEUE_MESSAGES,
+		MESSAGE_QUEUE_BYTES,
+		MESSAGE_QUEUE_FLUSH_TIME,
+		TIME_SLICED_JOBS,
+		TIME_SLICE_USAGE,
+		TIME_SLICE_OVERRUNS,
+		PHYSICS_3D_SLEEPING_OBJECTS,
 		MONITOR_MAX
 	};
 
@@ -105,6 +120,7 @@ public:
 
 	void set_process_time(double p_pt);
 	void set_physics_process_time(double p_pt);
+	void set_message_queue_statistics(uint64_t p_messages, uint64_t p_bytes, double p_flush_time);
 
 	void add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args);
 	void remove_custom_monitor(const StringName &p_id);
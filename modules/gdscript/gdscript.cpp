@@ -1941,6 +1941,11 @@ GDScriptInstance::~GDScriptInstance() {
 
 GDScriptLanguage *GDScriptLanguage::singleton = nullptr;
 
+thread_local int GDScriptLanguage::_debug_parse_err_line = -1;
+thread_local String GDScriptLanguage::_debug_parse_err_file;
+thread_local String GDScriptLanguage::_debug_error;
+thread_local GDScriptLanguage::CallStack GDScriptLanguage::_call_stack;
+
 String GDScriptLanguage::get_name() const {
 	return "GDScript";
 }
@@ -2013,6 +2018,23 @@ void GDScriptLanguage::init() {
 		_add_global(E.name, E.ptr);
 	}
 
+#ifdef DEBUG_ENABLED
+	// The sampling profiler can be started from the command line so it's usable
+	// without the editor, e.g. on headless servers:
+	// --gdscript-sample-profile=<file> [--gdscript-sample-rate=<samples per second>]
+	uint64_t sample_rate = 1000;
+	for (const String &arg : OS::get_singleton()->get_cmdline_args()) {
+		if (arg.begins_with("--gdscript-sample-profile=")) {
+			sampling_profiler_output = arg.get_slice("=", 1);
+		} else if (arg.begins_with("--gdscript-sample-rate=")) {
+			sample_rate = CLAMP(arg.get_slice("=", 1).to_int(), 1, 100000);
+		}
+	}
+	if (!sampling_profiler_output.is_empty()) {
+		sampling_profiler_start(1000000 / sample_rate);
+	}
+#endif
+
 #ifdef TESTS_ENABLED
 	GDScriptTests::GDScriptTestRunner::handle_cmdline();
 #endif
@@ -2032,10 +2054,18 @@ Error GDScriptLanguage::execute_file(const String &p_path) {
 }
 
 void GDScriptLanguage::finish() {
-	if (_call_stack) {
-		memdelete_arr(_call_stack);
-		_call_stack = nullptr;
+	_call_stack.free();
+
+#ifdef DEBUG_ENABLED
+	if (sampling_profiler) {
+		sampling_profiler_stop();
+		if (!sampling_profiler_output.is_empty() && sampling_profiler_save(sampling_profiler_output) == OK) {
+			print_line(vformat("GDScript sampling profile: %d samples saved to \"%s\".", sampling_profiler->get_sample_count(), sampling_profiler_output));
+		}
+		memdelete(sampling_profiler);
+		sampling_profiler = nullptr;
 	}
+#endif
 
 	// Clear the cache before parsing the script_list
 	GDScriptCache::clear();
@@ -2100,6 +2130,33 @@ void GDScriptLanguage::profiling_stop() {
 #endif
 }
 
+void GDScriptLanguage::sampling_profiler_start(uint64_t p_interval_usec) {
+#ifdef DEBUG_ENABLED
+	if (!sampling_profiler) {
+		sampling_profiler = memnew(GDScriptSamplingProfiler);
+	}
+	sampling_profiler->clear();
+	sampling_profiler->start(p_interval_usec);
+#endif
+}
+
+void GDScriptLanguage::sampling_profiler_stop() {
+#ifdef DEBUG_ENABLED
+	if (sampling_profiler) {
+		sampling_profiler->stop();
+	}
+#endif
+}
+
+Error GDScriptLanguage::sampling_profiler_save(const String &p_path) {
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_NULL_V_MSG(sampling_profiler, ERR_UNCONFIGURED, "The GDScript sampling profiler was never started.");
+	return sampling_profiler->save(p_path);
+#else
+	return ERR_UNAVAILABLE;
+#endif
+}
+
 int GDScriptLanguage::profiling_get_accumulated_data(ProfilingInfo *p_info_arr, int p_info_max) {
 	int current = 0;
 #ifdef DEBUG_ENABLED
@@ -2549,21 +2606,21 @@ GDScriptLanguage::GDScriptLanguage() {
 	profiling = false;
 	script_frame_time = 0;
 
-	_debug_call_stack_pos = 0;
 	int dmcs = GLOBAL_DEF("debug/settings/gdscript/max_call_stack", 1024);
 	ProjectSettings::get_singleton()->set_custom_property_info("debug/settings/gdscript/max_call_stack", PropertyInfo(Variant::INT, "debug/settings/gdscript/max_call_stack", PROPERTY_HINT_RANGE, "1024,4096,1,or_greater")); //minimum is 1024
 
 	if (EngineDebugger::is_active()) {
 		//debugging enabled!
 
+		// Call stacks are allocated by each thread when it first enters a function.
 		_debug_max_call_stack = dmcs;
-		_call_stack = memnew_arr(CallLevel, _debug_max_call_stack + 1);
 
 	} else {
 		_debug_max_call_stack = 0;
-		_call_stack = nullptr;
 	}
 
+	GLOBAL_DEF("gdscript/compiler/optimize", true);
+
 #ifdef DEBUG_ENABLED
 	GLOBAL_DEF("debug/gdscript/warnings/enable", true);
 	GLOBAL_DEF("debug/gdscript/warnings/treat_warnings_as_errors", false);
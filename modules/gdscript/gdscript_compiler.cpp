@@ -37,6 +37,7 @@
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/debugger/engine_debugger.h"
 
 bool GDScriptCompiler::_is_class_member_property(CodeGen &codegen, const StringName &p_name) {
 	if (codegen.function_node && codegen.function_node->is_static) {
@@ -212,6 +213,111 @@ static bool _have_exact_arguments(const MethodBind *p_method, const Vector<GDScr
 	return true;
 }
 
+static bool _is_inlinable_expression(const GDScriptParser::ExpressionNode *p_expression, const GDScriptParser::FunctionNode *p_function) {
+	if (p_expression->is_constant) {
+		return true;
+	}
+	GDScriptParser::DataType datatype = p_expression->get_datatype();
+	if (!datatype.is_hard_type() || datatype.kind != GDScriptParser::DataType::BUILTIN) {
+		return false;
+	}
+
+	switch (p_expression->type) {
+		case GDScriptParser::Node::IDENTIFIER: {
+			const GDScriptParser::IdentifierNode *identifier = static_cast<const GDScriptParser::IdentifierNode *>(p_expression);
+			return identifier->source == GDScriptParser::IdentifierNode::FUNCTION_PARAMETER && p_function->parameters_indices.has(identifier->name);
+		}
+		case GDScriptParser::Node::UNARY_OPERATOR: {
+			const GDScriptParser::UnaryOpNode *unary = static_cast<const GDScriptParser::UnaryOpNode *>(p_expression);
+			return _is_inlinable_expression(unary->operand, p_function);
+		}
+		case GDScriptParser::Node::BINARY_OPERATOR: {
+			const GDScriptParser::BinaryOpNode *binary = static_cast<const GDScriptParser::BinaryOpNode *>(p_expression);
+			if (binary->operation == GDScriptParser::BinaryOpNode::OP_TYPE_TEST) {
+				return false;
+			}
+			return _is_inlinable_expression(binary->left_operand, p_function) && _is_inlinable_expression(binary->right_operand, p_function);
+		}
+		case GDScriptParser::Node::TERNARY_OPERATOR: {
+			const GDScriptParser::TernaryOpNode *ternary = static_cast<const GDScriptParser::TernaryOpNode *>(p_expression);
+			return _is_inlinable_expression(ternary->condition, p_function) && _is_inlinable_expression(ternary->true_expr, p_function) && _is_inlinable_expression(ternary->false_expr, p_function);
+		}
+		default:
+			return false;
+	}
+}
+
+const GDScriptParser::FunctionNode *GDScriptCompiler::_get_inlinable_function(CodeGen &codegen, const GDScriptParser::CallNode *p_call, const Vector<GDScriptCodeGenerator::Address> &p_arguments) {
+	if (p_call->is_super || p_call->callee == nullptr) {
+		return nullptr;
+	}
+
+	// Only calls that can't be dispatched to an override are candidates: plain calls from a static
+	// function (which go through the class itself) and calls qualified with a class of this script.
+	const GDScriptParser::ClassNode *owner = nullptr;
+	if (p_call->callee->type == GDScriptParser::Node::IDENTIFIER) {
+		if (codegen.function_node && codegen.function_node->is_static) {
+			owner = codegen.class_node;
+		}
+	} else if (p_call->callee->type == GDScriptParser::Node::SUBSCRIPT) {
+		const GDScriptParser::SubscriptNode *subscript = static_cast<const GDScriptParser::SubscriptNode *>(p_call->callee);
+		GDScriptParser::DataType base_type = subscript->is_attribute ? subscript->base->get_datatype() : GDScriptParser::DataType();
+		if (base_type.is_meta_type && base_type.kind == GDScriptParser::DataType::CLASS && base_type.class_type != nullptr) {
+			owner = base_type.class_type;
+			// Only inline from classes of the file being compiled, other scripts may change independently.
+			const GDScriptParser::ClassNode *root = owner;
+			while (root->outer != nullptr) {
+				root = root->outer;
+			}
+			if (root != parser->get_tree()) {
+				owner = nullptr;
+			}
+		}
+	}
+	if (owner == nullptr || !owner->has_function(p_call->function_name)) {
+		return nullptr;
+	}
+
+	const GDScriptParser::FunctionNode *function = owner->get_member(p_call->function_name).function;
+	if (!function->is_static || function->is_coroutine || !function->resolved_body || function->body == nullptr) {
+		return nullptr;
+	}
+	// Default arguments would need their initializers evaluated, so require every argument to be given.
+	if (function->parameters.size() != p_arguments.size()) {
+		return nullptr;
+	}
+	if (function->body->statements.size() != 1 || function->body->statements[0]->type != GDScriptParser::Node::RETURN) {
+		return nullptr;
+	}
+	const GDScriptParser::ReturnNode *return_n = static_cast<const GDScriptParser::ReturnNode *>(function->body->statements[0]);
+	if (return_n->return_value == nullptr || !_is_inlinable_expression(return_n->return_value, function)) {
+		return nullptr;
+	}
+
+	// The returned value must not need a conversion to the declared return type.
+	GDScriptDataType return_type = _gdtype_from_datatype(function->get_datatype(), codegen.script);
+	GDScriptDataType value_type = _gdtype_from_datatype(return_n->return_value->get_datatype(), codegen.script);
+	if (return_type.has_type && (return_type.kind != GDScriptDataType::BUILTIN || return_type.builtin_type != value_type.builtin_type)) {
+		return nullptr;
+	}
+
+	for (int i = 0; i < p_arguments.size(); i++) {
+		// Temporaries can't be bound to parameters since the inlined expression may release them.
+		if (p_arguments[i].mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+			return nullptr;
+		}
+		GDScriptDataType par_type = _gdtype_from_datatype(function->parameters[i]->get_datatype(), codegen.script);
+		if (!par_type.has_type || par_type.kind != GDScriptDataType::BUILTIN) {
+			return nullptr;
+		}
+		if (!p_arguments[i].type.has_type || p_arguments[i].type.kind != GDScriptDataType::BUILTIN || p_arguments[i].type.builtin_type != par_type.builtin_type) {
+			return nullptr;
+		}
+	}
+
+	return function;
+}
+
 GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &codegen, Error &r_error, const GDScriptParser::ExpressionNode *p_expression, bool p_root, bool p_initializer, const GDScriptCodeGenerator::Address &p_index_addr) {
 	if (p_expression->is_constant) {
 		return codegen.add_constant(p_expression->reduced_value);
@@ -534,7 +640,28 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 				arguments.push_back(arg);
 			}
 
-			if (!call->is_super && call->callee->type == GDScriptParser::Node::IDENTIFIER && GDScriptParser::get_builtin_type(call->function_name) != Variant::VARIANT_MAX) {
+			const GDScriptParser::FunctionNode *inline_function = inline_functions ? _get_inlinable_function(codegen, call, arguments) : nullptr;
+
+			if (inline_function) {
+				// Small static function: evaluate its returned expression in place, with parameters bound to the arguments.
+				HashMap<StringName, GDScriptCodeGenerator::Address> caller_parameters = codegen.parameters;
+				codegen.parameters.clear();
+				for (int i = 0; i < inline_function->parameters.size(); i++) {
+					codegen.parameters.insert(inline_function->parameters[i]->identifier->name, arguments[i]);
+				}
+
+				const GDScriptParser::ReturnNode *return_n = static_cast<const GDScriptParser::ReturnNode *>(inline_function->body->statements[0]);
+				GDScriptCodeGenerator::Address value = _parse_expression(codegen, r_error, return_n->return_value);
+				codegen.parameters = caller_parameters;
+				if (r_error) {
+					return GDScriptCodeGenerator::Address();
+				}
+
+				gen->write_assign(result, value);
+				if (value.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+					gen->pop_temporary();
+				}
+			} else if (!call->is_super && call->callee->type == GDScriptParser::Node::IDENTIFIER && GDScriptParser::get_builtin_type(call->function_name) != Variant::VARIANT_MAX) {
 				// Construct a built-in type.
 				Variant::Type vtype = GDScriptParser::get_builtin_type(static_cast<GDScriptParser::IdentifierNode *>(call->callee)->name);
 
@@ -854,6 +981,20 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 			const GDScriptParser::TernaryOpNode *ternary = static_cast<const GDScriptParser::TernaryOpNode *>(p_expression);
 			GDScriptCodeGenerator::Address result = codegen.add_temporary(_gdtype_from_datatype(ternary->get_datatype(), codegen.script));
 
+			if (optimize && ternary->condition->is_constant) {
+				// Condition known at compile time, only the selected expression is evaluated.
+				const GDScriptParser::ExpressionNode *selected = ternary->condition->reduced_value.booleanize() ? ternary->true_expr : ternary->false_expr;
+				GDScriptCodeGenerator::Address value = _parse_expression(codegen, r_error, selected);
+				if (r_error) {
+					return GDScriptCodeGenerator::Address();
+				}
+				gen->write_assign(result, value);
+				if (value.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+					gen->pop_temporary();
+				}
+				return result;
+			}
+
 			gen->write_start_ternary(result);
 
 			GDScriptCodeGenerator::Address condition = _parse_expression(codegen, r_error, ternary->condition);
@@ -1759,6 +1900,19 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			} break;
 			case GDScriptParser::Node::IF: {
 				const GDScriptParser::IfNode *if_n = static_cast<const GDScriptParser::IfNode *>(s);
+
+				if (optimize && if_n->condition->is_constant) {
+					// Dead branch elimination: only compile the block that can be reached.
+					const GDScriptParser::SuiteNode *block = if_n->condition->reduced_value.booleanize() ? if_n->true_block : if_n->false_block;
+					if (block) {
+						err = _parse_block(codegen, block);
+						if (err) {
+							return err;
+						}
+					}
+					break;
+				}
+
 				GDScriptCodeGenerator::Address condition = _parse_expression(codegen, err, if_n->condition);
 				if (err) {
 					return err;
@@ -1819,6 +1973,11 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			case GDScriptParser::Node::WHILE: {
 				const GDScriptParser::WhileNode *while_n = static_cast<const GDScriptParser::WhileNode *>(s);
 
+				if (optimize && while_n->condition->is_constant && !while_n->condition->reduced_value.booleanize()) {
+					// Loop body is never entered.
+					break;
+				}
+
 				gen->start_while_condition();
 
 				GDScriptCodeGenerator::Address condition = _parse_expression(codegen, err, while_n->condition);
@@ -1973,6 +2132,11 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 				}
 			} break;
 		}
+
+		if (optimize && (s->type == GDScriptParser::Node::RETURN || s->type == GDScriptParser::Node::BREAK || s->type == GDScriptParser::Node::CONTINUE)) {
+			// Remaining statements in this block can't be reached.
+			break;
+		}
 	}
 
 	codegen.end_block();
@@ -2715,6 +2879,10 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 
 	source = p_script->get_path();
 
+	optimize = GLOBAL_GET("gdscript/compiler/optimize");
+	// Inlined functions have no frame of their own, keep them intact for breakpoints and stack traces.
+	inline_functions = optimize && !EngineDebugger::is_active();
+
 	// Create scripts for subclasses beforehand so they can be referenced
 	make_scripts(p_script, root, p_keep_state);
 
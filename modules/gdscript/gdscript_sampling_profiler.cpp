@@ -0,0 +1,143 @@
+/*************************************************************************/
+/*  gdscript_sampling_profiler.cpp                                       */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#include "gdscript_sampling_profiler.h"
+
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "gdscript.h"
+
+void GDScriptSamplingProfiler::_thread_func(void *p_userdata) {
+	GDScriptSamplingProfiler *profiler = static_cast<GDScriptSamplingProfiler *>(p_userdata);
+	while (!profiler->exit_thread.is_set()) {
+		OS::get_singleton()->delay_usec(profiler->interval_usec);
+		profiler->sample_requested.set();
+	}
+}
+
+String GDScriptSamplingProfiler::_get_frame_name(const Frame &p_frame) {
+	String path = p_frame.function->get_script() ? p_frame.function->get_script()->get_script_path() : String();
+	return path + ":" + String(p_frame.function->get_name()) + ":" + itos(p_frame.line ? *p_frame.line : 0);
+}
+
+void GDScriptSamplingProfiler::_take_sample() {
+	sample_requested.clear();
+	if (frames.is_empty()) {
+		return;
+	}
+
+	String stack;
+	for (uint32_t i = 0; i < frames.size(); i++) {
+		if (i > 0) {
+			stack += ";";
+		}
+		stack += _get_frame_name(frames[i]);
+	}
+
+	HashMap<String, uint64_t>::Iterator E = stack_samples.find(stack);
+	if (E) {
+		E->value++;
+	} else {
+		stack_samples.insert(stack, 1);
+	}
+
+	// Self hits for the line currently executing.
+	const Frame &leaf = frames[frames.size() - 1];
+	String line = leaf.function->get_script() ? leaf.function->get_script()->get_script_path() : String();
+	line += ":" + itos(leaf.line ? *leaf.line : 0) + " (" + String(leaf.function->get_name()) + ")";
+	E = line_samples.find(line);
+	if (E) {
+		E->value++;
+	} else {
+		line_samples.insert(line, 1);
+	}
+
+	sample_count++;
+}
+
+void GDScriptSamplingProfiler::start(uint64_t p_interval_usec) {
+	ERR_FAIL_COND_MSG(thread.is_started(), "GDScript sampling profiler is already running.");
+	interval_usec = MAX(p_interval_usec, (uint64_t)1);
+	exit_thread.clear();
+	sample_requested.clear();
+	thread.start(_thread_func, this);
+}
+
+void GDScriptSamplingProfiler::stop() {
+	if (!thread.is_started()) {
+		return;
+	}
+	exit_thread.set();
+	thread.wait_to_finish();
+	sample_requested.clear();
+}
+
+void GDScriptSamplingProfiler::clear() {
+	stack_samples.clear();
+	line_samples.clear();
+	sample_count = 0;
+}
+
+Error GDScriptSamplingProfiler::save(const String &p_path) const {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Cannot save GDScript sampling profile to file '" + p_path + "'.");
+
+	for (const KeyValue<String, uint64_t> &E : stack_samples) {
+		f->store_line(E.key + " " + itos(E.value));
+	}
+
+	// Line hit counts go to a sibling file, sorted from the hottest line.
+	Ref<FileAccess> lf = FileAccess::open(p_path + ".lines", FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Cannot save GDScript line hit counts to file '" + p_path + ".lines'.");
+
+	struct LineHits {
+		String line;
+		uint64_t hits = 0;
+		bool operator<(const LineHits &p_other) const { return hits > p_other.hits; }
+	};
+	Vector<LineHits> lines;
+	for (const KeyValue<String, uint64_t> &E : line_samples) {
+		LineHits lh;
+		lh.line = E.key;
+		lh.hits = E.value;
+		lines.push_back(lh);
+	}
+	lines.sort();
+	for (int i = 0; i < lines.size(); i++) {
+		lf->store_line(itos(lines[i].hits) + "\t" + lines[i].line);
+	}
+
+	return OK;
+}
+
+GDScriptSamplingProfiler::~GDScriptSamplingProfiler() {
+	stop();
+}
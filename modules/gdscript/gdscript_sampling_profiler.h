@@ -0,0 +1,107 @@
+/*************************************************************************/
+/*  gdscript_sampling_profiler.h                                         */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef GDSCRIPT_SAMPLING_PROFILER_H
+#define GDSCRIPT_SAMPLING_PROFILER_H
+
+#include "core/os/thread.h"
+#include "core/string/ustring.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+class GDScriptFunction;
+
+// Statistical profiler for GDScript. A timer thread periodically requests a sample,
+// which the main thread takes at the next executed line by walking its own copy of
+// the script call stack, so no script state is ever read from another thread.
+// Samples are aggregated as folded call stacks (one "frame;frame;frame count" line
+// per unique stack), the format used by flame graph tools, plus per-line hit counts.
+class GDScriptSamplingProfiler {
+	struct Frame {
+		GDScriptFunction *function = nullptr;
+		const int *line = nullptr;
+	};
+
+	LocalVector<Frame> frames;
+	SafeFlag sample_requested;
+	SafeFlag exit_thread;
+	Thread thread;
+	uint64_t interval_usec = 1000;
+	uint64_t sample_count = 0;
+
+	HashMap<String, uint64_t> stack_samples;
+	HashMap<String, uint64_t> line_samples;
+
+	static void _thread_func(void *p_userdata);
+	static String _get_frame_name(const Frame &p_frame);
+	void _take_sample();
+
+public:
+	_FORCE_INLINE_ void enter_function(GDScriptFunction *p_function, const int *p_line) {
+		if (Thread::get_main_id() != Thread::get_caller_id()) {
+			return; // Only the main thread is sampled.
+		}
+		if (frames.is_empty()) {
+			// Drop requests that arrived while no script was running.
+			sample_requested.clear();
+		}
+		Frame frame;
+		frame.function = p_function;
+		frame.line = p_line;
+		frames.push_back(frame);
+	}
+
+	_FORCE_INLINE_ void exit_function() {
+		if (Thread::get_main_id() != Thread::get_caller_id()) {
+			return;
+		}
+		ERR_FAIL_COND(frames.is_empty());
+		frames.resize(frames.size() - 1);
+	}
+
+	_FORCE_INLINE_ void poll() {
+		if (unlikely(sample_requested.is_set())) {
+			_take_sample();
+		}
+	}
+
+	void start(uint64_t p_interval_usec);
+	void stop();
+	bool is_running() const { return thread.is_started(); }
+
+	void clear();
+	uint64_t get_sample_count() const { return sample_count; }
+	Error save(const String &p_path) const;
+
+	~GDScriptSamplingProfiler();
+};
+
+#endif // GDSCRIPT_SAMPLING_PROFILER_H
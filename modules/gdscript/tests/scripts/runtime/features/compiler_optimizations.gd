@@ -0,0 +1,40 @@
+# Results must be the same whether `gdscript/compiler/optimize` is enabled or not.
+# This is a behavior check: the `MathUtils` calls below are qualified with a class
+# of this file, so they are inlined when optimizing, but the output can't tell.
+
+const DEBUG_MODE = false
+
+enum Quality { LOW, HIGH }
+const QUALITY = Quality.HIGH
+
+
+class MathUtils:
+	static func square(value: int) -> int:
+		return value * value
+
+	static func sum_of_squares(a: int, b: int) -> int:
+		return square(a) + square(b)
+
+	static func midpoint(a: float, b: float) -> float:
+		return a + (b - a) * 0.5
+
+
+func test():
+	if DEBUG_MODE:
+		print("debug")
+	elif QUALITY == Quality.HIGH:
+		print("high quality")
+	else:
+		print("low quality")
+
+	while DEBUG_MODE:
+		print("never")
+
+	print("debug" if DEBUG_MODE else "release")
+
+	var a := 3
+	var b := 4
+	print(MathUtils.square(a))
+	print(MathUtils.sum_of_squares(a, b))
+	print(MathUtils.midpoint(1.0, 2.0))
+	print(MathUtils.square(a + 1))
@@ -0,0 +1,32 @@
+func test():
+	var a := PackedFloat32Array([1.0, 2.0, 3.0, 4.0, 5.0])
+	print(a.sum())
+	print(a.dot(PackedFloat32Array([1.0, 1.0, 1.0, 1.0, 2.0])))
+	print(a.min(), " ", a.max())
+	a.multiply_add(2.0, 1.0)
+	print(a)
+	a.clamp(4.0, 9.0)
+	print(a)
+	a.prefix_sum()
+	print(a)
+
+	var b := PackedFloat64Array([0.0, 10.0, 20.0])
+	b.lerp(PackedFloat64Array([10.0, 10.0, 10.0]), 0.5)
+	print(b)
+	b.add(1.0)
+	b.multiply(2.0)
+	print(b)
+	print(b.gather(PackedInt32Array([2, 0, 2])))
+	b.scatter(PackedInt32Array([0, 2]), PackedFloat64Array([-1.0, -2.0]))
+	print(b)
+
+	var v := PackedVector2Array([Vector2(1, 2), Vector2(3, 4)])
+	v.add(Vector2(1, 1))
+	v.multiply_array(PackedVector2Array([Vector2(2, 2), Vector2(0.5, 0.5)]))
+	print(v)
+	print(v.sum())
+
+	var w := PackedVector3Array([Vector3(1, 2, 3), Vector3(4, 5, 6)])
+	w.add_array(w.duplicate())
+	w.multiply(0.5)
+	print(w)
@@ -0,0 +1,25 @@
+func test():
+	var ints: Array[int] = []
+	for i in 5:
+		ints.append(i)
+	ints[0] = 10
+	ints[-1] = ints[1] + ints[2]
+	ints.push_back(ints[4])
+
+	var total := 0
+	for value in ints:
+		total += value
+	print(ints)
+	print(total)
+
+	var vectors: Array[Vector3] = []
+	vectors.append(Vector3())
+	vectors.append(Vector3(1, 2, 3))
+	vectors[0] = vectors[1] * 2
+	print(vectors)
+
+	var untyped: Array = []
+	untyped.append(1)
+	untyped.append("two")
+	untyped[0] = Vector2(3, 4)
+	print(untyped)
@@ -120,11 +120,24 @@ void Node2D::_update_xform_values() {
 	_xform_dirty = false;
 }
 
+void Node2D::_sync_canvas_transform() {
+	if (!is_inside_tree() || !get_tree()->canvas_transform_batching) {
+		RenderingServer::get_singleton()->canvas_item_set_transform(get_canvas_item(), transform);
+		return;
+	}
+
+	// While processing, the transform is sent to the RenderingServer at the end of the frame, together with all the others.
+	MutexLock lock(get_tree()->xform_change_mutex);
+	if (!canvas_transform_sync.in_list()) {
+		get_tree()->canvas_transform_sync_list.add(&canvas_transform_sync);
+	}
+}
+
 void Node2D::_update_transform() {
 	transform.set_rotation_scale_and_skew(rotation, scale, skew);
 	transform.columns[2] = position;
 
-	RenderingServer::get_singleton()->canvas_item_set_transform(get_canvas_item(), transform);
+	_sync_canvas_transform();
 
 	if (!is_inside_tree()) {
 		return;
@@ -134,6 +147,7 @@ void Node2D::_update_transform() {
 }
 
 void Node2D::set_position(const Point2 &p_pos) {
+	ERR_THREAD_GROUP_GUARD;
 	if (_xform_dirty) {
 		const_cast<Node2D *>(this)->_update_xform_values();
 	}
@@ -142,6 +156,7 @@ void Node2D::set_position(const Point2 &p_pos) {
 }
 
 void Node2D::set_rotation(real_t p_radians) {
+	ERR_THREAD_GROUP_GUARD;
 	if (_xform_dirty) {
 		const_cast<Node2D *>(this)->_update_xform_values();
 	}
@@ -154,6 +169,7 @@ void Node2D::set_rotation_degrees(real_t p_degrees) {
 }
 
 void Node2D::set_skew(real_t p_radians) {
+	ERR_THREAD_GROUP_GUARD;
 	if (_xform_dirty) {
 		const_cast<Node2D *>(this)->_update_xform_values();
 	}
@@ -162,6 +178,7 @@ void Node2D::set_skew(real_t p_radians) {
 }
 
 void Node2D::set_scale(const Size2 &p_scale) {
+	ERR_THREAD_GROUP_GUARD;
 	if (_xform_dirty) {
 		const_cast<Node2D *>(this)->_update_xform_values();
 	}
@@ -323,10 +340,11 @@ void Node2D::set_global_scale(const Size2 &p_scale) {
 }
 
 void Node2D::set_transform(const Transform2D &p_transform) {
+	ERR_THREAD_GROUP_GUARD;
 	transform = p_transform;
 	_xform_dirty = true;
 
-	RenderingServer::get_singleton()->canvas_item_set_transform(get_canvas_item(), transform);
+	_sync_canvas_transform();
 
 	if (!is_inside_tree()) {
 		return;
@@ -382,6 +400,14 @@ void Node2D::_notification(int p_notification) {
 				get_viewport()->gui_set_root_order_dirty();
 			}
 		} break;
+
+		case NOTIFICATION_EXIT_TREE: {
+			MutexLock lock(get_tree()->xform_change_mutex);
+			if (canvas_transform_sync.in_list()) {
+				get_tree()->canvas_transform_sync_list.remove(&canvas_transform_sync);
+				RenderingServer::get_singleton()->canvas_item_set_transform(get_canvas_item(), transform);
+			}
+		} break;
 	}
 }
 
@@ -442,3 +468,7 @@ void Node2D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "global_skew", PROPERTY_HINT_NONE, "radians", PROPERTY_USAGE_NONE), "set_global_skew", "get_global_skew");
 	ADD_PROPERTY(PropertyInfo(Variant::TRANSFORM2D, "global_transform", PROPERTY_HINT_NONE, "suffix:px", PROPERTY_USAGE_NONE), "set_global_transform", "get_global_transform");
 }
+
+Node2D::Node2D() :
+		canvas_transform_sync(this) {
+}
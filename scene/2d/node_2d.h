@@ -45,7 +45,10 @@ class Node2D : public CanvasItem {
 
 	bool _xform_dirty = false;
 
+	SelfList<Node2D> canvas_transform_sync;
+
 	void _update_transform();
+	void _sync_canvas_transform();
 
 	void _update_xform_values();
 
@@ -114,7 +117,7 @@ public:
 
 	Transform2D get_transform() const override;
 
-	Node2D() {}
+	Node2D();
 };
 
 #endif // NODE_2D_H
@@ -74,12 +74,8 @@ Node3DGizmo::Node3DGizmo() {
 }
 
 void Node3D::_notify_dirty() {
-#ifdef TOOLS_ENABLED
-	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
-#else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
-
-#endif
+	if (_is_transform_notification_wanted() && !xform_change.in_list()) {
+		MutexLock lock(get_tree()->xform_change_mutex);
 		get_tree()->xform_change_list.add(&xform_change);
 	}
 }
@@ -106,6 +102,13 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
+	// A dirty global transform means a previous change already went through this subtree, and every
+	// node in it that wants a notification is still queued (see _transform_notification_changed()).
+	// Stopping here turns repeated changes within a frame into a single walk of the hierarchy.
+	if ((data.dirty & DIRTY_GLOBAL_TRANSFORM) && (xform_change.in_list() || !_is_transform_notification_wanted())) {
+		return;
+	}
+
 	data.children_lock++;
 
 	for (Node3D *&E : data.children) {
@@ -114,11 +117,8 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		}
 		E->_propagate_transform_changed(p_origin);
 	}
-#ifdef TOOLS_ENABLED
-	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
-#else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
-#endif
+	if (_is_transform_notification_wanted() && !xform_change.in_list()) {
+		MutexLock lock(get_tree()->xform_change_mutex);
 		get_tree()->xform_change_list.add(&xform_change);
 	}
 	data.dirty |= DIRTY_GLOBAL_TRANSFORM;
@@ -126,6 +126,14 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 	data.children_lock--;
 }
 
+void Node3D::_transform_notification_changed() {
+	// A node that starts wanting transform notifications while its global transform is dirty would not
+	// be queued by further changes from its parents. Resolve the transform so they propagate again.
+	if (is_inside_tree() && (data.dirty & DIRTY_GLOBAL_TRANSFORM) && _is_transform_notification_wanted() && !xform_change.in_list()) {
+		get_global_transform();
+	}
+}
+
 void Node3D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ENTER_TREE: {
@@ -207,6 +215,10 @@ void Node3D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
+			// Keep the global transform resolved once notified, so further changes reach this node again.
+			if (is_inside_tree()) {
+				get_global_transform();
+			}
 #ifdef TOOLS_ENABLED
 			for (int i = 0; i < data.gizmos.size(); i++) {
 				data.gizmos.write[i]->transform();
@@ -220,6 +232,7 @@ void Node3D::set_basis(const Basis &p_basis) {
 	set_transform(Transform3D(p_basis, data.local_transform.origin));
 }
 void Node3D::set_quaternion(const Quaternion &p_quaternion) {
+	ERR_THREAD_GROUP_GUARD;
 	if (data.dirty & DIRTY_EULER_ROTATION_AND_SCALE) {
 		// We need the scale part, so if these are dirty, update it
 		data.scale = data.local_transform.basis.get_scale();
@@ -268,6 +281,7 @@ void Node3D::set_global_rotation_degrees(const Vector3 &p_euler_degrees) {
 }
 
 void Node3D::set_transform(const Transform3D &p_transform) {
+	ERR_THREAD_GROUP_GUARD;
 	data.local_transform = p_transform;
 	data.dirty = DIRTY_EULER_ROTATION_AND_SCALE; // Make rot/scale dirty.
 
@@ -361,6 +375,7 @@ Transform3D Node3D::get_relative_transform(const Node *p_parent) const {
 }
 
 void Node3D::set_position(const Vector3 &p_position) {
+	ERR_THREAD_GROUP_GUARD;
 	data.local_transform.origin = p_position;
 	_propagate_transform_changed(this);
 	if (data.notify_local_transform) {
@@ -436,6 +451,7 @@ EulerOrder Node3D::get_rotation_order() const {
 }
 
 void Node3D::set_rotation(const Vector3 &p_euler_rad) {
+	ERR_THREAD_GROUP_GUARD;
 	if (data.dirty & DIRTY_EULER_ROTATION_AND_SCALE) {
 		// Update scale only if rotation and scale are dirty, as rotation will be overridden.
 		data.scale = data.local_transform.basis.get_scale();
@@ -456,6 +472,7 @@ void Node3D::set_rotation_degrees(const Vector3 &p_euler_degrees) {
 }
 
 void Node3D::set_scale(const Vector3 &p_scale) {
+	ERR_THREAD_GROUP_GUARD;
 	if (data.dirty & DIRTY_EULER_ROTATION_AND_SCALE) {
 		// Update rotation only if rotation and scale are dirty, as scale will be overridden.
 		data.euler_rotation = data.local_transform.basis.get_euler_normalized(data.euler_rotation_order);
@@ -547,6 +564,7 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		return;
 	}
 	data.gizmos.push_back(p_gizmo);
+	_transform_notification_changed();
 
 	if (p_gizmo.is_valid() && is_inside_world()) {
 		p_gizmo->create();
@@ -828,6 +846,7 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 
 void Node3D::set_notify_transform(bool p_enabled) {
 	data.notify_transform = p_enabled;
+	_transform_notification_changed();
 }
 
 bool Node3D::is_transform_notification_enabled() const {
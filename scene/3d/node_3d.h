@@ -132,6 +132,15 @@ private:
 	void _update_gizmos();
 	void _notify_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
+	void _transform_notification_changed();
+
+	_FORCE_INLINE_ bool _is_transform_notification_wanted() const {
+#ifdef TOOLS_ENABLED
+		return (!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification;
+#else
+		return data.notify_transform && !data.ignore_notification;
+#endif
+	}
 
 	void _propagate_visibility_changed();
 
@@ -139,7 +148,12 @@ private:
 	void _update_visibility_parent(bool p_update_root);
 
 protected:
-	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) { data.ignore_notification = p_ignore; }
+	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) {
+		data.ignore_notification = p_ignore;
+		if (!p_ignore) {
+			_transform_notification_changed();
+		}
+	}
 
 	_FORCE_INLINE_ void _update_local_transform() const;
 	_FORCE_INLINE_ void _update_rotation_and_scale() const;
@@ -763,6 +763,7 @@ void CanvasItem::_notify_transform(CanvasItem *p_node) {
 	if (p_node->notify_transform && !p_node->xform_change.in_list()) {
 		if (!p_node->block_transform_notify) {
 			if (p_node->is_inside_tree()) {
+				MutexLock lock(get_tree()->xform_change_mutex);
 				get_tree()->xform_change_list.add(&p_node->xform_change);
 			}
 		}
@@ -49,6 +49,11 @@ VARIANT_ENUM_CAST(Node::ProcessMode);
 VARIANT_ENUM_CAST(Node::InternalMode);
 
 int Node::orphan_node_count = 0;
+SafeNumeric<uint64_t> Node::get_node_call_count;
+SafeNumeric<uint64_t> Node::get_node_miss_count;
+
+thread_local int Node::current_process_thread_group = 0;
+thread_local LocalVector<Callable> *Node::current_thread_group_calls = nullptr;
 
 void Node::_notification(int p_notification) {
 	switch (p_notification) {
@@ -118,6 +123,10 @@ void Node::_notification(int p_notification) {
 				memdelete(data.path_cache);
 				data.path_cache = nullptr;
 			}
+			if (data.resolved_path_cache) {
+				memdelete(data.resolved_path_cache);
+				data.resolved_path_cache = nullptr;
+			}
 		} break;
 
 		case NOTIFICATION_PATH_RENAMED: {
@@ -260,7 +269,7 @@ void Node::_propagate_after_exit_tree() {
 			if (data.unique_name_in_owner) {
 				_release_unique_name_in_owner();
 			}
-			data.owner->data.owned.erase(data.OW);
+			_remove_from_owner_owned();
 			data.owner = nullptr;
 		}
 	}
@@ -323,6 +332,7 @@ void Node::_propagate_exit_tree() {
 }
 
 void Node::move_child(Node *p_child, int p_index) {
+	ERR_MAIN_THREAD_GUARD;
 	ERR_FAIL_NULL(p_child);
 	ERR_FAIL_COND_MSG(p_child->data.parent != this, "Child is not a child of this node.");
 
@@ -426,6 +436,7 @@ void Node::owner_changed_notify() {
 }
 
 void Node::set_physics_process(bool p_process) {
+	ERR_MAIN_THREAD_GUARD;
 	if (data.physics_process == p_process) {
 		return;
 	}
@@ -444,6 +455,7 @@ bool Node::is_physics_processing() const {
 }
 
 void Node::set_physics_process_internal(bool p_process_internal) {
+	ERR_MAIN_THREAD_GUARD;
 	if (data.physics_process_internal == p_process_internal) {
 		return;
 	}
@@ -462,6 +474,7 @@ bool Node::is_physics_processing_internal() const {
 }
 
 void Node::set_process_mode(ProcessMode p_mode) {
+	ERR_MAIN_THREAD_GUARD;
 	if (data.process_mode == p_mode) {
 		return;
 	}
@@ -748,6 +761,7 @@ double Node::get_process_delta_time() const {
 }
 
 void Node::set_process(bool p_process) {
+	ERR_MAIN_THREAD_GUARD;
 	if (data.process == p_process) {
 		return;
 	}
@@ -766,6 +780,7 @@ bool Node::is_processing() const {
 }
 
 void Node::set_process_internal(bool p_process_internal) {
+	ERR_MAIN_THREAD_GUARD;
 	if (data.process_internal == p_process_internal) {
 		return;
 	}
@@ -784,6 +799,7 @@ bool Node::is_processing_internal() const {
 }
 
 void Node::set_process_priority(int p_priority) {
+	ERR_MAIN_THREAD_GUARD;
 	data.process_priority = p_priority;
 
 	// Make sure we are in SceneTree.
@@ -812,6 +828,47 @@ int Node::get_process_priority() const {
 	return data.process_priority;
 }
 
+void Node::set_process_thread_group(int p_group) {
+	ERR_MAIN_THREAD_GUARD;
+	ERR_FAIL_COND_MSG(p_group < 0, "Process thread group must be zero (main thread) or positive.");
+	data.process_thread_group = p_group;
+}
+
+int Node::get_process_thread_group() const {
+	return data.process_thread_group;
+}
+
+void Node::call_deferred_thread_groupp(const StringName &p_method, const Variant **p_args, int p_argcount) {
+	if (current_thread_group_calls) {
+		// Processing a thread group: queue the call, it will be flushed on the main thread once all the groups are done.
+		Callable c = Callable(this, p_method);
+		current_thread_group_calls->push_back(p_argcount ? c.bindp(p_args, p_argcount) : c);
+	} else {
+		MessageQueue::get_singleton()->push_callp(get_instance_id(), p_method, p_args, p_argcount, true);
+	}
+}
+
+Variant Node::_call_deferred_thread_group_bind(const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
+	if (p_argcount < 1) {
+		r_error.error = Callable::CallError::CALL_ERROR_TOO_FEW_ARGUMENTS;
+		r_error.argument = 0;
+		return Variant();
+	}
+
+	if (p_args[0]->get_type() != Variant::STRING_NAME && p_args[0]->get_type() != Variant::STRING) {
+		r_error.error = Callable::CallError::CALL_ERROR_INVALID_ARGUMENT;
+		r_error.argument = 0;
+		r_error.expected = Variant::STRING_NAME;
+		return Variant();
+	}
+
+	r_error.error = Callable::CallError::CALL_OK;
+
+	call_deferred_thread_groupp(*p_args[0], &p_args[1], p_argcount - 1);
+
+	return Variant();
+}
+
 void Node::set_process_input(bool p_enable) {
 	if (p_enable == data.input) {
 		return;
@@ -898,10 +955,17 @@ StringName Node::get_name() const {
 }
 
 void Node::_set_name_nocheck(const StringName &p_name) {
+	if (data.parent) {
+		data.parent->_child_name_index_remove(this);
+	}
 	data.name = p_name;
+	if (data.parent) {
+		data.parent->_child_name_index_add(this);
+	}
 }
 
 void Node::set_name(const String &p_name) {
+	ERR_MAIN_THREAD_GUARD;
 	String name = p_name.validate_node_name();
 
 	ERR_FAIL_COND(name.is_empty());
@@ -909,10 +973,14 @@ void Node::set_name(const String &p_name) {
 	if (data.unique_name_in_owner && data.owner) {
 		_release_unique_name_in_owner();
 	}
+	if (data.parent) {
+		data.parent->_child_name_index_remove(this);
+	}
 	data.name = name;
 
 	if (data.parent) {
 		data.parent->_validate_child_name(this, true);
+		data.parent->_child_name_index_add(this);
 	}
 
 	if (data.unique_name_in_owner && data.owner) {
@@ -975,18 +1043,7 @@ void Node::_validate_child_name(Node *p_child, bool p_force_human_readable) {
 			unique = false;
 		} else {
 			//check if exists
-			Node **children = data.children.ptrw();
-			int cc = data.children.size();
-
-			for (int i = 0; i < cc; i++) {
-				if (children[i] == p_child) {
-					continue;
-				}
-				if (children[i]->data.name == p_child->data.name) {
-					unique = false;
-					break;
-				}
-			}
+			unique = !_has_child_named(p_child->data.name, p_child);
 		}
 
 		if (!unique) {
@@ -1029,25 +1086,9 @@ void Node::_generate_serial_child_name(const Node *p_child, StringName &name) co
 		name = p_child->get_class();
 	}
 
-	//quickly test if proposed name exists
-	int cc = data.children.size(); //children count
-	const Node *const *children_ptr = data.children.ptr();
-
-	{
-		bool exists = false;
-
-		for (int i = 0; i < cc; i++) {
-			if (children_ptr[i] == p_child) { //exclude self in renaming if it's already a child
-				continue;
-			}
-			if (children_ptr[i]->data.name == name) {
-				exists = true;
-			}
-		}
-
-		if (!exists) {
-			return; //if it does not exist, it does not need validation
-		}
+	//quickly test if proposed name exists, excluding self in renaming if it's already a child
+	if (!_has_child_named(name, p_child)) {
+		return; //if it does not exist, it does not need validation
 	}
 
 	// Extract trailing number
@@ -1074,18 +1115,8 @@ void Node::_generate_serial_child_name(const Node *p_child, StringName &name) co
 
 	for (;;) {
 		StringName attempt = name_string + nums;
-		bool exists = false;
 
-		for (int i = 0; i < cc; i++) {
-			if (children_ptr[i] == p_child) {
-				continue;
-			}
-			if (children_ptr[i]->data.name == attempt) {
-				exists = true;
-			}
-		}
-
-		if (!exists) {
+		if (!_has_child_named(attempt, p_child)) {
 			name = attempt;
 			return;
 		} else {
@@ -1107,6 +1138,7 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name) {
 	p_child->data.index = data.children.size();
 	data.children.push_back(p_child);
 	p_child->data.parent = this;
+	_child_name_index_add(p_child);
 
 	if (data.internal_children_back > 0) {
 		_move_child(p_child, data.children.size() - data.internal_children_back - 1);
@@ -1124,6 +1156,7 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name) {
 }
 
 void Node::add_child(Node *p_child, bool p_force_readable_name, InternalMode p_internal) {
+	ERR_MAIN_THREAD_GUARD;
 	ERR_FAIL_NULL(p_child);
 	ERR_FAIL_COND_MSG(p_child == this, vformat("Can't add child '%s' to itself.", p_child->get_name())); // adding to itself!
 	ERR_FAIL_COND_MSG(p_child->data.parent, vformat("Can't add child '%s' to '%s', already has a parent '%s'.", p_child->get_name(), get_name(), p_child->data.parent->get_name())); //Fail if node has a parent
@@ -1147,6 +1180,7 @@ void Node::add_child(Node *p_child, bool p_force_readable_name, InternalMode p_i
 }
 
 void Node::add_sibling(Node *p_sibling, bool p_force_readable_name) {
+	ERR_MAIN_THREAD_GUARD;
 	ERR_FAIL_NULL(p_sibling);
 	ERR_FAIL_NULL(data.parent);
 	ERR_FAIL_COND_MSG(p_sibling == this, vformat("Can't add sibling '%s' to itself.", p_sibling->get_name())); // adding to itself!
@@ -1164,6 +1198,7 @@ void Node::add_sibling(Node *p_sibling, bool p_force_readable_name) {
 }
 
 void Node::remove_child(Node *p_child) {
+	ERR_MAIN_THREAD_GUARD;
 	ERR_FAIL_NULL(p_child);
 	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, `remove_child()` failed. Consider using `remove_child.call_deferred(child)` instead.");
 
@@ -1203,6 +1238,13 @@ void Node::remove_child(Node *p_child) {
 	p_child->notification(NOTIFICATION_UNPARENTED);
 
 	data.children.remove_at(idx);
+	_child_name_index_remove(p_child);
+
+	// Exit tree callbacks may have cached paths to the child while it was still listed.
+	// The tree_changed signal was already emitted for the removal, so only the cached paths are invalidated.
+	if (data.tree) {
+		data.tree->tree_version++;
+	}
 
 	//update pointer and size
 	child_count = data.children.size();
@@ -1221,6 +1263,209 @@ void Node::remove_child(Node *p_child) {
 	}
 }
 
+void Node::add_children(const Vector<Node *> &p_children, bool p_force_readable_name) {
+	ERR_MAIN_THREAD_GUARD;
+	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, `add_children()` failed. Consider using `add_children.call_deferred(children)` instead.");
+
+	// Validate the whole batch first, so it is either added entirely or not at all.
+	for (int i = 0; i < p_children.size(); i++) {
+		Node *child = p_children[i];
+		ERR_FAIL_NULL(child);
+		ERR_FAIL_COND_MSG(child == this, vformat("Can't add child '%s' to itself.", child->get_name()));
+		ERR_FAIL_COND_MSG(child->data.parent, vformat("Can't add child '%s' to '%s', already has a parent '%s'.", child->get_name(), get_name(), child->data.parent->get_name()));
+#ifdef DEBUG_ENABLED
+		ERR_FAIL_COND_MSG(child->is_ancestor_of(this), vformat("Can't add child '%s' to '%s' as it would result in a cyclic dependency since '%s' is already a parent of '%s'.", child->get_name(), get_name(), child->get_name(), get_name()));
+#endif
+	}
+
+	// Names are validated against the name index, so it is needed for the duration of the batch
+	// even if the final child count doesn't justify keeping it.
+	bool temporary_index = !data.children_by_name;
+	if (temporary_index) {
+		_build_child_name_index();
+	}
+
+	// Build the new children vector once, keeping internal back children at the end.
+	int old_count = data.children.size();
+	int insert_at = old_count - data.internal_children_back;
+	Vector<Node *> children;
+	children.resize(old_count + p_children.size());
+	Node **children_ptrw = children.ptrw();
+	for (int i = 0; i < insert_at; i++) {
+		children_ptrw[i] = data.children[i];
+	}
+
+	// Kept aside for the notifications, as their callbacks may reorder or remove siblings.
+	LocalVector<ObjectID> added_ids;
+	added_ids.reserve(p_children.size());
+
+	int added = 0;
+	for (int i = 0; i < p_children.size(); i++) {
+		Node *child = p_children[i];
+		ERR_CONTINUE_MSG(child->data.parent, vformat("Can't add child '%s' twice in the same batch.", child->get_name()));
+
+		_validate_child_name(child, p_force_readable_name);
+		data.children_by_name->insert(child->data.name, child);
+		child->data.parent = this;
+		child->data.index = insert_at + added;
+		children_ptrw[insert_at + added] = child;
+		added_ids.push_back(child->get_instance_id());
+		added++;
+	}
+
+	for (int i = insert_at; i < old_count; i++) {
+		Node *back_child = data.children[i];
+		back_child->data.index = added + i;
+		children_ptrw[added + i] = back_child;
+	}
+	children.resize(old_count + added);
+	data.children = children;
+
+	if (temporary_index && data.children.size() < CHILD_NAME_INDEX_MIN_CHILDREN) {
+		memdelete(data.children_by_name);
+		data.children_by_name = nullptr;
+	}
+
+	// Notify in order, as if each child was added individually, but only signal the tree change once.
+	for (uint32_t i = 0; i < added_ids.size(); i++) {
+		Node *child = Object::cast_to<Node>(ObjectDB::get_instance(added_ids[i]));
+		if (!child || child->data.parent != this) {
+			continue; // Freed or removed by a sibling while entering the tree.
+		}
+
+		child->notification(NOTIFICATION_PARENTED);
+
+		if (data.tree) {
+			child->_propagate_enter_tree();
+			if (data.ready_notified) {
+				child->_propagate_ready();
+			}
+		}
+
+		child->data.parent_owned = data.in_constructor;
+		add_child_notify(child);
+	}
+
+	if (added > 0 && data.internal_children_back > 0) {
+		for (int i = data.children.size() - data.internal_children_back; i < data.children.size(); i++) {
+			data.children[i]->notification(NOTIFICATION_MOVED_IN_PARENT);
+		}
+	}
+
+	if (data.tree && added > 0) {
+		data.tree->tree_changed();
+	}
+}
+
+void Node::remove_children(const Vector<Node *> &p_children) {
+	ERR_MAIN_THREAD_GUARD;
+	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, `remove_children()` failed. Consider using `remove_children.call_deferred(children)` instead.");
+
+	for (int i = 0; i < p_children.size(); i++) {
+		Node *child = p_children[i];
+		ERR_FAIL_NULL(child);
+		ERR_FAIL_COND_MSG(child->data.parent != this, vformat("Cannot remove child node '%s' as it is not a child of this node.", child->get_name()));
+	}
+
+	LocalVector<Node *> removed;
+	removed.reserve(p_children.size());
+	LocalVector<bool> is_removed;
+	is_removed.resize(data.children.size());
+	for (uint32_t i = 0; i < is_removed.size(); i++) {
+		is_removed[i] = false;
+	}
+
+	// Classify against the original layout, as the internal counters can only be adjusted once all
+	// the removed children are known.
+	int removed_front = 0;
+	int removed_back = 0;
+	for (int i = 0; i < p_children.size(); i++) {
+		Node *child = p_children[i];
+		if (is_removed[child->data.index]) {
+			continue; // Listed twice.
+		}
+
+		if (child->_is_internal_front()) {
+			removed_front++;
+		} else if (child->_is_internal_back()) {
+			removed_back++;
+		}
+		is_removed[child->data.index] = true;
+		removed.push_back(child);
+	}
+
+	// Take the children out of the tree first. The layout can't change meanwhile, so the children
+	// vector is compacted in a single pass afterwards.
+	data.blocked++;
+	for (uint32_t i = 0; i < removed.size(); i++) {
+		Node *child = removed[i];
+		child->_set_tree(nullptr);
+
+		remove_child_notify(child);
+		child->notification(NOTIFICATION_UNPARENTED);
+	}
+	data.blocked--;
+
+	LocalVector<Node *> moved;
+	Node **children = data.children.ptrw();
+	int child_count = 0;
+	for (int i = 0; i < data.children.size(); i++) {
+		Node *child = children[i];
+		if (is_removed[i]) {
+			continue;
+		}
+		if (child_count != i) {
+			children[child_count] = child;
+			child->data.index = child_count;
+			moved.push_back(child);
+		}
+		child_count++;
+	}
+	data.children.resize(child_count);
+	data.internal_children_front -= removed_front;
+	data.internal_children_back -= removed_back;
+
+	// Exit tree callbacks may have cached paths to the children while they were still listed.
+	// The tree_changed signal was already emitted for the removal, so only the cached paths are invalidated.
+	if (data.tree) {
+		data.tree->tree_version++;
+	}
+
+	for (uint32_t i = 0; i < removed.size(); i++) {
+		_child_name_index_remove(removed[i]);
+		removed[i]->data.parent = nullptr;
+		removed[i]->data.index = -1;
+	}
+
+	for (uint32_t i = 0; i < moved.size(); i++) {
+		moved[i]->notification(NOTIFICATION_MOVED_IN_PARENT);
+	}
+
+	if (data.inside_tree) {
+		for (uint32_t i = 0; i < removed.size(); i++) {
+			removed[i]->_propagate_after_exit_tree();
+		}
+	}
+}
+
+void Node::_add_children(const TypedArray<Node> &p_children, bool p_force_readable_name) {
+	Vector<Node *> children;
+	children.resize(p_children.size());
+	for (int i = 0; i < p_children.size(); i++) {
+		children.write[i] = Object::cast_to<Node>(p_children[i]);
+	}
+	add_children(children, p_force_readable_name);
+}
+
+void Node::_remove_children(const TypedArray<Node> &p_children) {
+	Vector<Node *> children;
+	children.resize(p_children.size());
+	for (int i = 0; i < p_children.size(); i++) {
+		children.write[i] = Object::cast_to<Node>(p_children[i]);
+	}
+	remove_children(children);
+}
+
 int Node::get_child_count(bool p_include_internal) const {
 	if (p_include_internal) {
 		return data.children.size();
@@ -1247,6 +1492,11 @@ Node *Node::get_child(int p_index, bool p_include_internal) const {
 }
 
 Node *Node::_get_child_by_name(const StringName &p_name) const {
+	if (data.children_by_name) {
+		Node *const *child = data.children_by_name->getptr(p_name);
+		return child ? *child : nullptr;
+	}
+
 	int cc = data.children.size();
 	Node *const *cd = data.children.ptr();
 
@@ -1259,13 +1509,115 @@ Node *Node::_get_child_by_name(const StringName &p_name) const {
 	return nullptr;
 }
 
+bool Node::_has_child_named(const StringName &p_name, const Node *p_exclude) const {
+	if (data.children_by_name) {
+		Node *const *child = data.children_by_name->getptr(p_name);
+		return child && *child != p_exclude;
+	}
+
+	int cc = data.children.size();
+	Node *const *cd = data.children.ptr();
+
+	for (int i = 0; i < cc; i++) {
+		if (cd[i] != p_exclude && cd[i]->data.name == p_name) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void Node::_build_child_name_index() {
+	data.children_by_name = memnew((HashMap<StringName, Node *>));
+	data.children_by_name->reserve(data.children.size());
+	for (int i = 0; i < data.children.size(); i++) {
+		data.children_by_name->insert(data.children[i]->data.name, data.children[i]);
+	}
+}
+
+void Node::_child_name_index_add(Node *p_child) {
+	if (!data.children_by_name) {
+		if (data.children.size() >= CHILD_NAME_INDEX_MIN_CHILDREN) {
+			// Build the whole index once the threshold is crossed, it is kept up to date from then on.
+			_build_child_name_index();
+		}
+		return;
+	}
+
+	data.children_by_name->insert(p_child->data.name, p_child);
+}
+
+void Node::_child_name_index_remove(Node *p_child) {
+	if (!data.children_by_name) {
+		return;
+	}
+
+	// The child may not be indexed under its name yet (e.g. while being renamed).
+	HashMap<StringName, Node *>::Iterator E = data.children_by_name->find(p_child->data.name);
+	if (E && E->value == p_child) {
+		data.children_by_name->remove(E);
+	}
+
+	if (data.children.size() < CHILD_NAME_INDEX_MIN_CHILDREN / 2) {
+		memdelete(data.children_by_name);
+		data.children_by_name = nullptr;
+	}
+}
+
 Node *Node::get_node_or_null(const NodePath &p_path) const {
+	get_node_call_count.increment();
+
 	if (p_path.is_empty()) {
+		get_node_miss_count.increment();
 		return nullptr;
 	}
 
 	ERR_FAIL_COND_V_MSG(!data.inside_tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
 
+	// Resolved paths are cached while inside the tree. Any structural change or rename bumps the tree version,
+	// which invalidates the whole cache. Unique names depend on ownership instead, so they are never cached.
+	bool use_cache = data.inside_tree && Thread::get_caller_id() == Thread::get_main_id();
+	if (use_cache) {
+		for (int i = 0; i < p_path.get_name_count(); i++) {
+			if (p_path.get_name(i).is_node_unique_name()) {
+				use_cache = false;
+				break;
+			}
+		}
+	}
+
+	if (use_cache && data.resolved_path_cache) {
+		if (data.resolved_path_cache->tree_version != data.tree->tree_version) {
+			data.resolved_path_cache->nodes.clear();
+			data.resolved_path_cache->tree_version = data.tree->tree_version;
+		} else {
+			Node **cached = data.resolved_path_cache->nodes.getptr(p_path);
+			if (cached) {
+				return *cached;
+			}
+		}
+	}
+
+	Node *node = _resolve_node_path(p_path);
+	if (!node) {
+		get_node_miss_count.increment();
+		return nullptr;
+	}
+
+	if (use_cache) {
+		if (!data.resolved_path_cache) {
+			data.resolved_path_cache = memnew(ResolvedPathCache);
+			data.resolved_path_cache->tree_version = data.tree->tree_version;
+		} else if (data.resolved_path_cache->nodes.size() >= RESOLVED_PATH_CACHE_MAX) {
+			data.resolved_path_cache->nodes.clear();
+		}
+		data.resolved_path_cache->nodes.insert(p_path, node);
+	}
+
+	return node;
+}
+
+Node *Node::_resolve_node_path(const NodePath &p_path) const {
 	Node *current = nullptr;
 	Node *root = nullptr;
 
@@ -1317,16 +1669,7 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 			}
 
 		} else {
-			next = nullptr;
-
-			for (int j = 0; j < current->data.children.size(); j++) {
-				Node *child = current->data.children[j];
-
-				if (child->data.name == name) {
-					next = child;
-					break;
-				}
-			}
+			next = current->_get_child_by_name(name);
 			if (next == nullptr) {
 				return nullptr;
 			};
@@ -1538,12 +1881,23 @@ void Node::_set_owner_nocheck(Node *p_owner) {
 
 	ERR_FAIL_COND(data.owner);
 	data.owner = p_owner;
+	data.owned_index = data.owner->data.owned.size();
 	data.owner->data.owned.push_back(this);
-	data.OW = data.owner->data.owned.back();
 
 	owner_changed_notify();
 }
 
+void Node::_remove_from_owner_owned() {
+	// The owned list is unordered, so the last node can take the place of this one.
+	LocalVector<Node *> &owned = data.owner->data.owned;
+	ERR_FAIL_INDEX(data.owned_index, (int)owned.size());
+	Node *last = owned[owned.size() - 1];
+	owned[data.owned_index] = last;
+	last->data.owned_index = data.owned_index;
+	owned.resize(owned.size() - 1);
+	data.owned_index = -1;
+}
+
 void Node::_release_unique_name_in_owner() {
 	ERR_FAIL_NULL(data.owner); // Sanity check.
 	StringName key = StringName(UNIQUE_NODE_PREFIX + data.name.operator String());
@@ -1590,12 +1944,12 @@ bool Node::is_unique_name_in_owner() const {
 }
 
 void Node::set_owner(Node *p_owner) {
+	ERR_MAIN_THREAD_GUARD;
 	if (data.owner) {
 		if (data.unique_name_in_owner) {
 			_release_unique_name_in_owner();
 		}
-		data.owner->data.owned.erase(data.OW);
-		data.OW = nullptr;
+		_remove_from_owner_owned();
 		data.owner = nullptr;
 	}
 
@@ -1777,6 +2131,7 @@ bool Node::is_in_group(const StringName &p_identifier) const {
 }
 
 void Node::add_to_group(const StringName &p_identifier, bool p_persistent) {
+	ERR_MAIN_THREAD_GUARD;
 	ERR_FAIL_COND(!p_identifier.operator String().length());
 
 	if (data.grouped.has(p_identifier)) {
@@ -1797,6 +2152,7 @@ void Node::add_to_group(const StringName &p_identifier, bool p_persistent) {
 }
 
 void Node::remove_from_group(const StringName &p_identifier) {
+	ERR_MAIN_THREAD_GUARD;
 	HashMap<StringName, GroupData>::Iterator E = data.grouped.find(p_identifier);
 
 	if (!E) {
@@ -2416,7 +2772,7 @@ void Node::replace_by(Node *p_node, bool p_keep_groups) {
 	ERR_FAIL_NULL(p_node);
 	ERR_FAIL_COND(p_node->data.parent);
 
-	List<Node *> owned = data.owned;
+	LocalVector<Node *> owned = data.owned;
 	List<Node *> owned_by_owner;
 	Node *owner = (data.owner == this) ? p_node : data.owner;
 
@@ -2456,7 +2812,7 @@ void Node::replace_by(Node *p_node, bool p_keep_groups) {
 	}
 
 	p_node->set_owner(owner);
-	for (int i = 0; i < owned.size(); i++) {
+	for (uint32_t i = 0; i < owned.size(); i++) {
 		owned[i]->set_owner(p_node);
 	}
 
@@ -2615,6 +2971,7 @@ void Node::print_orphan_nodes() {
 }
 
 void Node::queue_free() {
+	ERR_MAIN_THREAD_GUARD;
 	// There are users which instantiate multiple scene trees for their games.
 	// Use the node's own tree to handle its deletion when relevant.
 	if (is_inside_tree()) {
@@ -2626,6 +2983,13 @@ void Node::queue_free() {
 	}
 }
 
+void Node::queue_free_children(bool p_include_internal) {
+	ERR_MAIN_THREAD_GUARD;
+	SceneTree *tree = is_inside_tree() ? get_tree() : SceneTree::get_singleton();
+	ERR_FAIL_NULL_MSG(tree, "Can't queue free children when no SceneTree is available.");
+	tree->queue_delete_children(this, p_include_internal);
+}
+
 TypedArray<Node> Node::_get_children(bool p_include_internal) const {
 	TypedArray<Node> arr;
 	int cc = get_child_count(p_include_internal);
@@ -2786,6 +3150,8 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_name"), &Node::get_name);
 	ClassDB::bind_method(D_METHOD("add_child", "node", "force_readable_name", "internal"), &Node::add_child, DEFVAL(false), DEFVAL(0));
 	ClassDB::bind_method(D_METHOD("remove_child", "node"), &Node::remove_child);
+	ClassDB::bind_method(D_METHOD("add_children", "nodes", "force_readable_name"), &Node::_add_children, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("remove_children", "nodes"), &Node::_remove_children);
 	ClassDB::bind_method(D_METHOD("get_child_count", "include_internal"), &Node::get_child_count, DEFVAL(false)); // Note that the default value bound for include_internal is false, while the method is declared with true. This is because internal nodes are irrelevant for GDSCript.
 	ClassDB::bind_method(D_METHOD("get_children", "include_internal"), &Node::_get_children, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_child", "idx", "include_internal"), &Node::get_child, DEFVAL(false));
@@ -2825,6 +3191,8 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_process", "enable"), &Node::set_process);
 	ClassDB::bind_method(D_METHOD("set_process_priority", "priority"), &Node::set_process_priority);
 	ClassDB::bind_method(D_METHOD("get_process_priority"), &Node::get_process_priority);
+	ClassDB::bind_method(D_METHOD("set_process_thread_group", "group"), &Node::set_process_thread_group);
+	ClassDB::bind_method(D_METHOD("get_process_thread_group"), &Node::get_process_thread_group);
 	ClassDB::bind_method(D_METHOD("is_processing"), &Node::is_processing);
 	ClassDB::bind_method(D_METHOD("set_process_input", "enable"), &Node::set_process_input);
 	ClassDB::bind_method(D_METHOD("is_processing_input"), &Node::is_processing_input);
@@ -2861,6 +3229,7 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_viewport"), &Node::get_viewport);
 
 	ClassDB::bind_method(D_METHOD("queue_free"), &Node::queue_free);
+	ClassDB::bind_method(D_METHOD("queue_free_children", "include_internal"), &Node::queue_free_children, DEFVAL(false));
 
 	ClassDB::bind_method(D_METHOD("request_ready"), &Node::request_ready);
 
@@ -2901,6 +3270,14 @@ void Node::_bind_methods() {
 		ClassDB::bind_vararg_method(METHOD_FLAGS_DEFAULT, "rpc_id", &Node::_rpc_id_bind, mi);
 	}
 
+	{
+		MethodInfo mi;
+		mi.name = "call_deferred_thread_group";
+		mi.arguments.push_back(PropertyInfo(Variant::STRING_NAME, "method"));
+
+		ClassDB::bind_vararg_method(METHOD_FLAGS_DEFAULT, "call_deferred_thread_group", &Node::_call_deferred_thread_group_bind, mi, varray(), false);
+	}
+
 	ClassDB::bind_method(D_METHOD("update_configuration_warnings"), &Node::update_configuration_warnings);
 
 	BIND_CONSTANT(NOTIFICATION_ENTER_TREE);
@@ -2979,6 +3356,7 @@ void Node::_bind_methods() {
 	ADD_GROUP("Process", "process_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_mode", PROPERTY_HINT_ENUM, "Inherit,Pausable,When Paused,Always,Disabled"), "set_process_mode", "get_process_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_priority"), "set_process_priority", "get_process_priority");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_RANGE, "0,1024,1,or_greater"), "set_process_thread_group", "get_process_thread_group");
 
 	ADD_GROUP("Editor Description", "editor_");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "editor_description", PROPERTY_HINT_MULTILINE_TEXT), "set_editor_description", "get_editor_description");
@@ -3018,6 +3396,13 @@ Node::~Node() {
 	data.owned.clear();
 	data.children.clear();
 
+	if (data.children_by_name) {
+		memdelete(data.children_by_name);
+	}
+	if (data.resolved_path_cache) {
+		memdelete(data.resolved_path_cache);
+	}
+
 	ERR_FAIL_COND(data.parent);
 	ERR_FAIL_COND(data.children.size());
 
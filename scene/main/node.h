@@ -41,6 +41,16 @@ class SceneState;
 class Tween;
 class PropertyTweener;
 
+#ifdef DEBUG_ENABLED
+// Scene tree structure and processing state can only be changed from the main thread.
+#define ERR_MAIN_THREAD_GUARD ERR_FAIL_COND_MSG(Node::get_current_process_thread_group() != 0, vformat("%s can't be called while processing a thread group, use call_deferred_thread_group() instead.", __FUNCTION__));
+// Node state can be changed from the main thread, or from the thread group the node belongs to.
+#define ERR_THREAD_GROUP_GUARD ERR_FAIL_COND_MSG(!is_accessible_from_caller_thread(), vformat("%s can't be called on a node from a different thread group, use call_deferred_thread_group() instead.", __FUNCTION__));
+#else
+#define ERR_MAIN_THREAD_GUARD
+#define ERR_THREAD_GROUP_GUARD
+#endif
+
 class Node : public Object {
 	GDCLASS(Node, Object);
 
@@ -84,13 +94,25 @@ public:
 	};
 
 	static int orphan_node_count;
+	static SafeNumeric<uint64_t> get_node_call_count;
+	static SafeNumeric<uint64_t> get_node_miss_count;
 
 private:
+	enum {
+		CHILD_NAME_INDEX_MIN_CHILDREN = 64, // Below this, a linear scan over the children is faster than hashing.
+		RESOLVED_PATH_CACHE_MAX = 64,
+	};
+
 	struct GroupData {
 		bool persistent = false;
 		SceneTree::Group *group = nullptr;
 	};
 
+	struct ResolvedPathCache {
+		uint64_t tree_version = 0; // Entries are only valid for the tree version they were resolved in.
+		HashMap<NodePath, Node *> nodes;
+	};
+
 	// This Data struct is to avoid namespace pollution in derived classes.
 	struct Data {
 		String scene_file_path;
@@ -100,6 +122,7 @@ private:
 		Node *parent = nullptr;
 		Node *owner = nullptr;
 		Vector<Node *> children;
+		HashMap<StringName, Node *> *children_by_name = nullptr; // Only built for nodes with many children.
 		HashMap<StringName, Node *> owned_unique_nodes;
 		bool unique_name_in_owner = false;
 
@@ -121,8 +144,8 @@ private:
 		Viewport *viewport = nullptr;
 
 		HashMap<StringName, GroupData> grouped;
-		List<Node *>::Element *OW = nullptr; // Owned element.
-		List<Node *> owned;
+		int owned_index = -1; // Index in the owner's owned list.
+		LocalVector<Node *> owned;
 
 		ProcessMode process_mode = PROCESS_MODE_INHERIT;
 		Node *process_owner = nullptr;
@@ -135,6 +158,7 @@ private:
 		bool physics_process = false;
 		bool process = false;
 		int process_priority = 0;
+		int process_thread_group = 0;
 
 		bool physics_process_internal = false;
 		bool process_internal = false;
@@ -152,6 +176,7 @@ private:
 		bool editable_instance = false;
 
 		mutable NodePath *path_cache = nullptr;
+		mutable ResolvedPathCache *resolved_path_cache = nullptr;
 
 	} data;
 
@@ -161,6 +186,11 @@ private:
 	void _print_tree(const Node *p_node);
 
 	Node *_get_child_by_name(const StringName &p_name) const;
+	bool _has_child_named(const StringName &p_name, const Node *p_exclude) const;
+	void _build_child_name_index();
+	void _child_name_index_add(Node *p_child);
+	void _child_name_index_remove(Node *p_child);
+	Node *_resolve_node_path(const NodePath &p_path) const;
 
 	void _replace_connections_target(Node *p_new_target);
 
@@ -181,9 +211,12 @@ private:
 	Node *_duplicate(int p_flags, HashMap<const Node *, Node *> *r_duplimap = nullptr) const;
 
 	TypedArray<Node> _get_children(bool p_include_internal = true) const;
+	void _add_children(const TypedArray<Node> &p_children, bool p_force_readable_name);
+	void _remove_children(const TypedArray<Node> &p_children);
 	TypedArray<StringName> _get_groups() const;
 
 	Error _rpc_bind(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
+	Variant _call_deferred_thread_group_bind(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	Error _rpc_id_bind(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
 	_FORCE_INLINE_ bool _is_internal_front() const { return data.parent && data.index < data.parent->data.internal_children_front; }
@@ -191,6 +224,9 @@ private:
 
 	friend class SceneTree;
 
+	static thread_local int current_process_thread_group;
+	static thread_local LocalVector<Callable> *current_thread_group_calls;
+
 	void _set_tree(SceneTree *p_tree);
 	void _propagate_pause_notification(bool p_enable);
 
@@ -198,6 +234,7 @@ private:
 	_FORCE_INLINE_ bool _is_enabled() const;
 
 	void _release_unique_name_in_owner();
+	void _remove_from_owner_owned();
 	void _acquire_unique_name_in_owner();
 
 protected:
@@ -306,6 +343,8 @@ public:
 	void add_child(Node *p_child, bool p_force_readable_name = false, InternalMode p_internal = INTERNAL_MODE_DISABLED);
 	void add_sibling(Node *p_sibling, bool p_force_readable_name = false);
 	void remove_child(Node *p_child);
+	void add_children(const Vector<Node *> &p_children, bool p_force_readable_name = false);
+	void remove_children(const Vector<Node *> &p_children);
 
 	int get_child_count(bool p_include_internal = true) const;
 	Node *get_child(int p_index, bool p_include_internal = true) const;
@@ -406,6 +445,13 @@ public:
 	void set_process_priority(int p_priority);
 	int get_process_priority() const;
 
+	void set_process_thread_group(int p_group);
+	int get_process_thread_group() const;
+
+	static int get_current_process_thread_group() { return current_process_thread_group; }
+	_FORCE_INLINE_ bool is_accessible_from_caller_thread() const { return current_process_thread_group == 0 || current_process_thread_group == data.process_thread_group; }
+	void call_deferred_thread_groupp(const StringName &p_method, const Variant **p_args, int p_argcount);
+
 	void set_process_input(bool p_enable);
 	bool is_processing_input() const;
 
@@ -460,6 +506,7 @@ public:
 	static String adjust_name_casing(const String &p_name);
 
 	void queue_free();
+	void queue_free_children(bool p_include_internal = false);
 
 	//hacks for speed
 	static void init_node_hrcr();
@@ -31,6 +31,7 @@
 #include "scene_tree.h"
 
 #include "core/config/project_settings.h"
+#include "core/core_string_names.h"
 #include "core/debugger/engine_debugger.h"
 #include "core/input/input.h"
 #include "core/io/dir_access.h"
@@ -38,10 +39,12 @@
 #include "core/io/marshalls.h"
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/keyboard.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 #include "node.h"
+#include "scene/2d/node_2d.h"
 #include "scene/animation/tween.h"
 #include "scene/debugger/scene_debugger.h"
 #include "scene/gui/control.h"
@@ -139,25 +142,74 @@ void SceneTree::node_renamed(Node *p_node) {
 	emit_signal(node_renamed_name, p_node);
 }
 
+template <class C>
+static int _group_lower_bound(const Vector<Node *> &p_nodes, const Node *p_node) {
+	C compare;
+	const Node *const *nodes = p_nodes.ptr();
+	int low = 0;
+	int high = p_nodes.size();
+	while (low < high) {
+		int middle = (low + high) / 2;
+		if (compare(nodes[middle], p_node)) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	return low;
+}
+
+static int _group_find_sorted_position(const Vector<Node *> &p_nodes, bool p_priority_order, const Node *p_node) {
+	if (p_priority_order) {
+		return _group_lower_bound<Node::ComparatorWithPriority>(p_nodes, p_node);
+	}
+	return _group_lower_bound<Node::Comparator>(p_nodes, p_node);
+}
+
 SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_node) {
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	if (!E) {
 		E = group_map.insert(p_group, Group());
 	}
 
-	ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
-	E->value.nodes.push_back(p_node);
-	//E->value.last_tree_version=0;
-	E->value.changed = true;
-	return &E->value;
+	// Membership is already checked by the node through its own group list.
+	Group &g = E->value;
+	if (g.changed || !p_node->is_inside_tree()) {
+		g.nodes.push_back(p_node);
+		g.changed = true;
+	} else {
+		// Keep the group sorted, so it doesn't need a full sort on the next call.
+		// New nodes are usually the last ones in tree order, so check that first.
+		int count = g.nodes.size();
+		if (count == 0 || (g.priority_order ? Node::ComparatorWithPriority()(g.nodes[count - 1], p_node) : Node::Comparator()(g.nodes[count - 1], p_node))) {
+			g.nodes.push_back(p_node);
+		} else {
+			g.nodes.insert(_group_find_sorted_position(g.nodes, g.priority_order, p_node), p_node);
+		}
+	}
+	return &g;
 }
 
 void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	ERR_FAIL_COND(!E);
 
-	E->value.nodes.erase(p_node);
-	if (E->value.nodes.is_empty()) {
+	Group &g = E->value;
+	int index = -1;
+	if (!g.changed && p_node->is_inside_tree()) {
+		index = _group_find_sorted_position(g.nodes, g.priority_order, p_node);
+		if (index >= g.nodes.size() || g.nodes[index] != p_node) {
+			index = -1;
+		}
+	}
+	if (index == -1) {
+		index = g.nodes.find(p_node);
+	}
+	if (index != -1) {
+		g.nodes.remove_at(index);
+	}
+
+	if (g.nodes.is_empty()) {
 		group_map.remove(E);
 	}
 }
@@ -169,6 +221,28 @@ void SceneTree::make_group_changed(const StringName &p_group) {
 	}
 }
 
+void SceneTree::_flush_canvas_transforms() {
+	canvas_transform_batching = false;
+
+	SelfList<Node2D> *n = canvas_transform_sync_list.first();
+	if (!n) {
+		return;
+	}
+
+	Vector<RID> items;
+	Vector<Transform2D> transforms;
+	while (n) {
+		Node2D *node = n->self();
+		SelfList<Node2D> *nx = n->next();
+		canvas_transform_sync_list.remove(n);
+		n = nx;
+		items.push_back(node->get_canvas_item());
+		transforms.push_back(node->get_transform());
+	}
+
+	RenderingServer::get_singleton()->canvas_item_set_transforms(items, transforms);
+}
+
 void SceneTree::flush_transform_notifications() {
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
@@ -219,6 +293,30 @@ void SceneTree::_update_group_order(Group &g, bool p_use_priority) {
 		node_sort.sort(gr_nodes, gr_node_count);
 	}
 	g.changed = false;
+	g.priority_order = p_use_priority;
+}
+
+static _FORCE_INLINE_ void _call_group_node(Node *p_node, const StringName &p_function, const Variant **p_args, int p_argcount, StringName &r_method_class, MethodBind *&r_method) {
+	Callable::CallError ce;
+#ifdef DEBUG_ENABLED
+	// Object::callp() holds the debug lock that catches the node being freed during the call.
+	p_node->callp(p_function, p_args, p_argcount, ce);
+#else
+	if (p_node->get_script_instance() || p_function == CoreStringNames::get_singleton()->_free) {
+		p_node->callp(p_function, p_args, p_argcount, ce);
+		return;
+	}
+
+	// Without a script, this is what Object::callp() ends up calling.
+	const StringName &class_name = p_node->get_class_name();
+	if (class_name != r_method_class) {
+		r_method_class = class_name;
+		r_method = ClassDB::get_method(class_name, p_function);
+	}
+	if (r_method) {
+		r_method->call(p_node, p_args, p_argcount, ce);
+	}
+#endif
 }
 
 void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
@@ -254,9 +352,13 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 	_update_group_order(g);
 
 	Vector<Node *> nodes_copy = g.nodes;
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr(); // Not ptrw(), that would copy the shared nodes.
 	int gr_node_count = nodes_copy.size();
 
+	// Groups usually contain many nodes of the same class, look up the method bind once for all of them.
+	StringName method_class;
+	MethodBind *method = nullptr;
+
 	call_lock++;
 
 	if (p_call_flags & GROUP_CALL_REVERSE) {
@@ -266,8 +368,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 			}
 
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				gr_nodes[i]->callp(p_function, p_args, p_argcount, ce);
+				_call_group_node(gr_nodes[i], p_function, p_args, p_argcount, method_class, method);
 			} else {
 				MessageQueue::get_singleton()->push_callp(gr_nodes[i], p_function, p_args, p_argcount);
 			}
@@ -280,8 +381,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 			}
 
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				gr_nodes[i]->callp(p_function, p_args, p_argcount, ce);
+				_call_group_node(gr_nodes[i], p_function, p_args, p_argcount, method_class, method);
 			} else {
 				MessageQueue::get_singleton()->push_callp(gr_nodes[i], p_function, p_args, p_argcount);
 			}
@@ -307,7 +407,7 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 	_update_group_order(g);
 
 	Vector<Node *> nodes_copy = g.nodes;
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr(); // Not ptrw(), that would copy the shared nodes.
 	int gr_node_count = nodes_copy.size();
 
 	call_lock++;
@@ -358,7 +458,7 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 	_update_group_order(g);
 
 	Vector<Node *> nodes_copy = g.nodes;
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr(); // Not ptrw(), that would copy the shared nodes.
 	int gr_node_count = nodes_copy.size();
 
 	call_lock++;
@@ -413,6 +513,7 @@ void SceneTree::initialize() {
 
 bool SceneTree::physics_process(double p_time) {
 	root_lock++;
+	canvas_transform_batching = true;
 
 	current_frame++;
 
@@ -439,11 +540,14 @@ bool SceneTree::physics_process(double p_time) {
 	_flush_delete_queue();
 	_call_idle_callbacks();
 
+	_flush_canvas_transforms();
+
 	return _quit;
 }
 
 bool SceneTree::process(double p_time) {
 	root_lock++;
+	canvas_transform_batching = true;
 
 	MainLoop::process(p_time);
 
@@ -465,6 +569,8 @@ bool SceneTree::process(double p_time) {
 	_notify_group_pause(SNAME("_process_internal"), Node::NOTIFICATION_INTERNAL_PROCESS);
 	_notify_group_pause(SNAME("_process"), Node::NOTIFICATION_PROCESS);
 
+	_process_time_sliced_jobs();
+
 	_flush_ugc();
 	MessageQueue::get_singleton()->flush(); //small little hack
 	flush_transform_notifications(); //transforms after world update, to avoid unnecessary enter/exit notifications
@@ -481,6 +587,8 @@ bool SceneTree::process(double p_time) {
 
 	_call_idle_callbacks();
 
+	_flush_canvas_transforms();
+
 #ifdef TOOLS_ENABLED
 #ifndef _3D_DISABLED
 	if (Engine::get_singleton()->is_editor_hint()) {
@@ -854,7 +962,15 @@ void SceneTree::_notify_group_pause(const StringName &p_group, int p_notificatio
 	Vector<Node *> nodes_copy = g.nodes;
 
 	int gr_node_count = nodes_copy.size();
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr(); // Not ptrw(), that would copy the shared nodes.
+
+	// Nodes in a process thread group, and extension classes that opted in to batched processing,
+	// are only handled separately for the user facing process notifications.
+	const bool user_process = p_notification == Node::NOTIFICATION_PROCESS || p_notification == Node::NOTIFICATION_PHYSICS_PROCESS;
+	LocalVector<ExtensionProcessBatch> batches;
+	ProcessThreadGroupPass thread_groups;
+	thread_groups.notification = p_notification;
+	HashMap<int, uint32_t> thread_group_indices;
 
 	call_lock++;
 
@@ -871,16 +987,116 @@ void SceneTree::_notify_group_pause(const StringName &p_group, int p_notificatio
 			continue;
 		}
 
+		if (user_process && n->data.process_thread_group != 0) {
+			HashMap<int, uint32_t>::Iterator G = thread_group_indices.find(n->data.process_thread_group);
+			if (!G) {
+				G = thread_group_indices.insert(n->data.process_thread_group, thread_groups.groups.size());
+				thread_groups.groups.push_back(ProcessThreadGroup());
+				thread_groups.groups[G->value].id = n->data.process_thread_group;
+			}
+			thread_groups.groups[G->value].nodes.push_back(n);
+			continue;
+		}
+
+		if (user_process && n->_get_extension() && !n->get_script_instance()) {
+			const ObjectGDExtension *extension = n->_get_extension();
+			GDExtensionClassBatchProcess func = p_notification == Node::NOTIFICATION_PROCESS ? extension->batch_process : extension->batch_physics_process;
+			if (func) {
+				ExtensionProcessBatch *batch = nullptr;
+				for (uint32_t j = 0; j < batches.size(); j++) {
+					if (batches[j].extension == extension) {
+						batch = &batches[j];
+						break;
+					}
+				}
+				if (!batch) {
+					batches.push_back(ExtensionProcessBatch());
+					batch = &batches[batches.size() - 1];
+					batch->extension = extension;
+					batch->func = func;
+				}
+				batch->nodes.push_back(n);
+				continue;
+			}
+		}
+
 		n->notification(p_notification);
 		//ERR_FAIL_COND(gr_node_count != g.nodes.size());
 	}
 
+	if (!batches.is_empty()) {
+		const double delta = p_notification == Node::NOTIFICATION_PROCESS ? process_time : physics_process_time;
+		for (uint32_t i = 0; i < batches.size(); i++) {
+			ExtensionProcessBatch &batch = batches[i];
+			// Nodes may have been removed from processing by the per-node callbacks above.
+			batch.instances.reserve(batch.nodes.size());
+			for (uint32_t j = 0; j < batch.nodes.size(); j++) {
+				if (call_skip.has(batch.nodes[j])) {
+					continue;
+				}
+				batch.instances.push_back(batch.nodes[j]->_get_extension_instance());
+			}
+			if (!batch.instances.is_empty()) {
+				batch.func(batch.extension->class_userdata, batch.instances.ptr(), batch.instances.size(), delta);
+			}
+		}
+	}
+
+	// Nodes may have been removed from processing, or freed, by the main thread callbacks above.
+	for (uint32_t i = 0; i < thread_groups.groups.size(); i++) {
+		LocalVector<Node *> &group_nodes = thread_groups.groups[i].nodes;
+		uint32_t count = 0;
+		for (uint32_t j = 0; j < group_nodes.size(); j++) {
+			if (!call_skip.has(group_nodes[j])) {
+				group_nodes[count++] = group_nodes[j];
+			}
+		}
+		group_nodes.resize(count);
+		if (count == 0) {
+			thread_groups.groups.remove_at(i);
+			i--;
+		}
+	}
+
+	if (!thread_groups.groups.is_empty()) {
+		// Thread groups run in parallel with each other, the nodes of each group are processed in order on a single thread.
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_thread_group, &thread_groups, thread_groups.groups.size(), -1, true, SNAME("SceneTreeProcessThreadGroups"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		// Flush the calls deferred by each group, in group order.
+		for (uint32_t i = 0; i < thread_groups.groups.size(); i++) {
+			const LocalVector<Callable> &calls = thread_groups.groups[i].calls;
+			for (uint32_t j = 0; j < calls.size(); j++) {
+				Variant ret;
+				Callable::CallError ce;
+				calls[j].callp(nullptr, 0, ret, ce);
+				if (ce.error != Callable::CallError::CALL_OK) {
+					ERR_PRINT("Error calling deferred method from process thread group: " + Variant::get_callable_error_text(calls[j], nullptr, 0, ce) + ".");
+				}
+			}
+		}
+	}
+
 	call_lock--;
 	if (call_lock == 0) {
 		call_skip.clear();
 	}
 }
 
+void SceneTree::_process_thread_group(uint32_t p_index, ProcessThreadGroupPass *p_pass) {
+	ProcessThreadGroup &group = p_pass->groups[p_index];
+
+	Node::current_process_thread_group = group.id;
+	Node::current_thread_group_calls = &group.calls;
+
+	for (uint32_t i = 0; i < group.nodes.size(); i++) {
+		group.nodes[i]->notification(p_pass->notification);
+	}
+
+	Node::current_process_thread_group = 0;
+	Node::current_thread_group_calls = nullptr;
+}
+
 void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_call_type, const Ref<InputEvent> &p_input, Viewport *p_viewport) {
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	if (!E) {
@@ -898,7 +1114,7 @@ void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_cal
 	Vector<Node *> nodes_copy = g.nodes;
 
 	int gr_node_count = nodes_copy.size();
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr(); // Not ptrw(), that would copy the shared nodes.
 
 	call_lock++;
 
@@ -1037,6 +1253,24 @@ Node *SceneTree::get_first_node_in_group(const StringName &p_group) {
 	return E->value.nodes[0];
 }
 
+Vector<Node *> SceneTree::get_group_nodes(const StringName &p_group) {
+	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
+	if (!E) {
+		return Vector<Node *>();
+	}
+
+	_update_group_order(E->value); //update order just in case
+	return E->value.nodes;
+}
+
+int SceneTree::get_node_count_in_group(const StringName &p_group) const {
+	HashMap<StringName, Group>::ConstIterator E = group_map.find(p_group);
+	if (!E) {
+		return 0;
+	}
+	return E->value.nodes.size();
+}
+
 void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_list) {
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	if (!E) {
@@ -1057,6 +1291,34 @@ void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_li
 void SceneTree::_flush_delete_queue() {
 	_THREAD_SAFE_METHOD_
 
+	while (delete_children_queue.size()) {
+		// Deleting may queue more batches, so work on a copy.
+		LocalVector<ChildrenDeleteBatch> batches = delete_children_queue;
+		delete_children_queue.clear();
+
+		for (uint32_t i = 0; i < batches.size(); i++) {
+			Node *parent = Object::cast_to<Node>(ObjectDB::get_instance(batches[i].parent));
+			Vector<Node *> to_remove;
+			for (uint32_t j = 0; j < batches[i].children.size(); j++) {
+				Node *child = Object::cast_to<Node>(ObjectDB::get_instance(batches[i].children[j]));
+				if (child && parent && child->get_parent() == parent) {
+					to_remove.push_back(child);
+				}
+			}
+
+			if (to_remove.size()) {
+				parent->remove_children(to_remove);
+			}
+			// Resolved again one by one, as deleting a node may free or reparent the following ones.
+			for (uint32_t j = 0; j < batches[i].children.size(); j++) {
+				Node *child = Object::cast_to<Node>(ObjectDB::get_instance(batches[i].children[j]));
+				if (child) {
+					memdelete(child);
+				}
+			}
+		}
+	}
+
 	while (delete_queue.size()) {
 		Object *obj = ObjectDB::get_instance(delete_queue.front()->get());
 		if (obj) {
@@ -1073,6 +1335,22 @@ void SceneTree::queue_delete(Object *p_object) {
 	delete_queue.push_back(p_object->get_instance_id());
 }
 
+void SceneTree::queue_delete_children(Node *p_parent, bool p_include_internal) {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_NULL(p_parent);
+
+	ChildrenDeleteBatch batch;
+	batch.parent = p_parent->get_instance_id();
+	int count = p_parent->get_child_count(p_include_internal);
+	batch.children.resize(count);
+	for (int i = 0; i < count; i++) {
+		Node *child = p_parent->get_child(i, p_include_internal);
+		child->_is_queued_for_deletion = true;
+		batch.children[i] = child->get_instance_id();
+	}
+	delete_children_queue.push_back(batch);
+}
+
 int SceneTree::get_node_count() const {
 	return node_count;
 }
@@ -1169,6 +1447,160 @@ Ref<Tween> SceneTree::create_tween() {
 	return tween;
 }
 
+void SceneTree::_process_time_sliced_jobs() {
+	time_slice_usage_usec = 0;
+	if (time_sliced_jobs.is_empty()) {
+		return;
+	}
+
+	time_sliced_order.clear();
+	for (uint32_t i = 0; i < time_sliced_jobs.size(); i++) {
+		const TimeSlicedJob &job = time_sliced_jobs[i];
+		if (!job.callable.is_valid()) {
+			// The object the job runs on was freed.
+			time_sliced_jobs[i].removed = true;
+			time_sliced_jobs_removed = true;
+			continue;
+		}
+		const Node *node = Object::cast_to<Node>(job.callable.get_object());
+		if (node && (!node->is_inside_tree() || !node->_can_process(paused))) {
+			continue;
+		}
+		time_sliced_order.push_back(i);
+	}
+
+	struct JobComparator {
+		const TimeSlicedJob *jobs = nullptr;
+		_FORCE_INLINE_ bool operator()(uint32_t p_a, uint32_t p_b) const {
+			const TimeSlicedJob &a = jobs[p_a];
+			const TimeSlicedJob &b = jobs[p_b];
+			if (a.priority != b.priority) {
+				return a.priority < b.priority;
+			}
+			if (a.last_run != b.last_run) {
+				return a.last_run < b.last_run;
+			}
+			return a.id < b.id;
+		}
+	};
+
+	SortArray<uint32_t, JobComparator> sorter;
+	sorter.compare.jobs = time_sliced_jobs.ptr();
+	sorter.sort(time_sliced_order.ptr(), time_sliced_order.size());
+
+	const uint64_t budget_usec = uint64_t(time_slice_budget * 1000.0);
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	uint64_t elapsed = 0;
+
+	time_sliced_jobs_running = true;
+
+	for (uint32_t i = 0; i < time_sliced_order.size(); i++) {
+		// At least one job runs every frame, so jobs make progress even with a tiny budget.
+		if (i > 0 && elapsed >= budget_usec) {
+			break;
+		}
+
+		uint32_t index = time_sliced_order[i];
+		if (time_sliced_jobs[index].removed) {
+			continue; // Removed by a job that ran before.
+		}
+		time_sliced_jobs[index].last_run = ++time_sliced_run_count;
+
+		// Jobs may add other jobs, which can reallocate the job list.
+		Callable callable = time_sliced_jobs[index].callable;
+		Variant ret;
+		Callable::CallError ce;
+		callable.callp(nullptr, 0, ret, ce);
+		if (ce.error != Callable::CallError::CALL_OK) {
+			ERR_PRINT("Error calling time-sliced job: " + Variant::get_callable_error_text(callable, nullptr, 0, ce) + ".");
+			time_sliced_jobs[index].removed = true;
+			time_sliced_jobs_removed = true;
+		} else if (ret.get_type() == Variant::BOOL && !ret.operator bool()) {
+			// The job is done.
+			time_sliced_jobs[index].removed = true;
+			time_sliced_jobs_removed = true;
+		}
+
+		elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+	}
+
+	time_sliced_jobs_running = false;
+
+	time_slice_usage_usec = elapsed;
+	if (elapsed > budget_usec) {
+		time_slice_overrun_count++;
+	}
+
+	if (time_sliced_jobs_removed) {
+		uint32_t to = 0;
+		for (uint32_t i = 0; i < time_sliced_jobs.size(); i++) {
+			if (time_sliced_jobs[i].removed) {
+				continue;
+			}
+			if (to != i) {
+				time_sliced_jobs[to] = time_sliced_jobs[i];
+			}
+			to++;
+		}
+		time_sliced_jobs.resize(to);
+		time_sliced_jobs_removed = false;
+	}
+}
+
+void SceneTree::add_time_sliced_job(const Callable &p_callable, int p_priority) {
+	ERR_FAIL_COND_MSG(!p_callable.is_valid(), "Invalid callable for time-sliced job.");
+	ERR_FAIL_COND_MSG(has_time_sliced_job(p_callable), "Time-sliced job already added: " + String(p_callable) + ".");
+
+	TimeSlicedJob job;
+	job.callable = p_callable;
+	job.priority = p_priority;
+	job.id = ++time_sliced_job_id;
+	time_sliced_jobs.push_back(job);
+}
+
+void SceneTree::remove_time_sliced_job(const Callable &p_callable) {
+	for (uint32_t i = 0; i < time_sliced_jobs.size(); i++) {
+		if (!time_sliced_jobs[i].removed && time_sliced_jobs[i].callable == p_callable) {
+			if (time_sliced_jobs_running) {
+				// Keep the indices of the jobs being run valid, compact once they are done.
+				time_sliced_jobs[i].removed = true;
+				time_sliced_jobs_removed = true;
+			} else {
+				time_sliced_jobs.remove_at(i);
+			}
+			return;
+		}
+	}
+}
+
+bool SceneTree::has_time_sliced_job(const Callable &p_callable) const {
+	for (uint32_t i = 0; i < time_sliced_jobs.size(); i++) {
+		if (!time_sliced_jobs[i].removed && time_sliced_jobs[i].callable == p_callable) {
+			return true;
+		}
+	}
+	return false;
+}
+
+int SceneTree::get_time_sliced_job_count() const {
+	int count = 0;
+	for (uint32_t i = 0; i < time_sliced_jobs.size(); i++) {
+		if (!time_sliced_jobs[i].removed) {
+			count++;
+		}
+	}
+	return count;
+}
+
+void SceneTree::set_time_slice_budget(double p_msec) {
+	ERR_FAIL_COND_MSG(p_msec < 0, "The time slice budget can't be negative.");
+	time_slice_budget = p_msec;
+}
+
+double SceneTree::get_time_slice_budget() const {
+	return time_slice_budget;
+}
+
 TypedArray<Tween> SceneTree::get_processed_tweens() {
 	TypedArray<Tween> ret;
 	ret.resize(tweens.size());
@@ -1260,6 +1692,13 @@ void SceneTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("create_tween"), &SceneTree::create_tween);
 	ClassDB::bind_method(D_METHOD("get_processed_tweens"), &SceneTree::get_processed_tweens);
 
+	ClassDB::bind_method(D_METHOD("add_time_sliced_job", "callable", "priority"), &SceneTree::add_time_sliced_job, DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("remove_time_sliced_job", "callable"), &SceneTree::remove_time_sliced_job);
+	ClassDB::bind_method(D_METHOD("has_time_sliced_job", "callable"), &SceneTree::has_time_sliced_job);
+	ClassDB::bind_method(D_METHOD("get_time_sliced_job_count"), &SceneTree::get_time_sliced_job_count);
+	ClassDB::bind_method(D_METHOD("set_time_slice_budget", "msec"), &SceneTree::set_time_slice_budget);
+	ClassDB::bind_method(D_METHOD("get_time_slice_budget"), &SceneTree::get_time_slice_budget);
+
 	ClassDB::bind_method(D_METHOD("get_node_count"), &SceneTree::get_node_count);
 	ClassDB::bind_method(D_METHOD("get_frame"), &SceneTree::get_frame);
 	ClassDB::bind_method(D_METHOD("quit", "exit_code"), &SceneTree::quit, DEFVAL(EXIT_SUCCESS));
@@ -1289,6 +1728,7 @@ void SceneTree::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_nodes_in_group", "group"), &SceneTree::_get_nodes_in_group);
 	ClassDB::bind_method(D_METHOD("get_first_node_in_group", "group"), &SceneTree::get_first_node_in_group);
+	ClassDB::bind_method(D_METHOD("get_node_count_in_group", "group"), &SceneTree::get_node_count_in_group);
 
 	ClassDB::bind_method(D_METHOD("set_current_scene", "child_node"), &SceneTree::set_current_scene);
 	ClassDB::bind_method(D_METHOD("get_current_scene"), &SceneTree::get_current_scene);
@@ -1315,6 +1755,7 @@ void SceneTree::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "current_scene", PROPERTY_HINT_RESOURCE_TYPE, "Node", PROPERTY_USAGE_NONE), "set_current_scene", "get_current_scene");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "root", PROPERTY_HINT_RESOURCE_TYPE, "Node", PROPERTY_USAGE_NONE), "", "get_root");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "multiplayer_poll"), "set_multiplayer_poll_enabled", "is_multiplayer_poll_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "time_slice_budget", PROPERTY_HINT_RANGE, "0,100,0.01,or_greater,suffix:ms"), "set_time_slice_budget", "get_time_slice_budget");
 
 	ADD_SIGNAL(MethodInfo("tree_changed"));
 	ADD_SIGNAL(MethodInfo("tree_process_mode_changed")); //editor only signal, but due to API hash it can't be removed in run-time
@@ -1392,6 +1833,9 @@ SceneTree::SceneTree() {
 
 	GLOBAL_DEF("debug/shapes/collision/draw_2d_outlines", true);
 
+	time_slice_budget = GLOBAL_DEF("application/run/time_slice_budget_msec", 2.0);
+	ProjectSettings::get_singleton()->set_custom_property_info("application/run/time_slice_budget_msec", PropertyInfo(Variant::FLOAT, "application/run/time_slice_budget_msec", PROPERTY_HINT_RANGE, "0,100,0.01,or_greater,suffix:ms"));
+
 	Math::randomize();
 
 	// Create with mainloop.
@@ -40,6 +40,7 @@
 
 class PackedScene;
 class Node;
+class Node2D;
 class Window;
 class Material;
 class Mesh;
@@ -89,6 +90,25 @@ private:
 	struct Group {
 		Vector<Node *> nodes;
 		bool changed = false;
+		bool priority_order = false; // Whether the nodes were last sorted by process priority.
+	};
+
+	struct ExtensionProcessBatch {
+		const ObjectGDExtension *extension = nullptr;
+		GDExtensionClassBatchProcess func = nullptr;
+		LocalVector<Node *> nodes;
+		LocalVector<GDExtensionClassInstancePtr> instances;
+	};
+
+	struct ProcessThreadGroup {
+		int id = 0;
+		LocalVector<Node *> nodes;
+		LocalVector<Callable> calls; // Deferred from the group thread, flushed on the main thread.
+	};
+
+	struct ProcessThreadGroupPass {
+		int notification = 0;
+		LocalVector<ProcessThreadGroup> groups;
 	};
 
 	Window *root = nullptr;
@@ -139,6 +159,14 @@ private:
 
 	List<ObjectID> delete_queue;
 
+	struct ChildrenDeleteBatch {
+		ObjectID parent;
+		LocalVector<ObjectID> children;
+	};
+	// Children queued together are removed from their parent in one go before being deleted.
+	LocalVector<ChildrenDeleteBatch> delete_children_queue;
+	void queue_delete_children(Node *p_parent, bool p_include_internal);
+
 	HashMap<UGCall, Vector<Variant>, UGCall> unique_group_calls;
 	bool ugc_locked = false;
 	void _flush_ugc();
@@ -167,6 +195,26 @@ private:
 	List<Ref<SceneTreeTimer>> timers;
 	List<Ref<Tween>> tweens;
 
+	struct TimeSlicedJob {
+		Callable callable;
+		int priority = 0;
+		uint64_t last_run = 0; // Jobs of the same priority that ran least recently go first.
+		uint64_t id = 0;
+		bool removed = false;
+	};
+
+	LocalVector<TimeSlicedJob> time_sliced_jobs;
+	LocalVector<uint32_t> time_sliced_order;
+	uint64_t time_sliced_job_id = 0;
+	uint64_t time_sliced_run_count = 0;
+	double time_slice_budget = 2.0; // In milliseconds.
+	bool time_sliced_jobs_running = false;
+	bool time_sliced_jobs_removed = false;
+	uint64_t time_slice_usage_usec = 0;
+	uint64_t time_slice_overrun_count = 0;
+
+	void _process_time_sliced_jobs();
+
 	///network///
 
 	Ref<MultiplayerAPI> multiplayer;
@@ -188,6 +236,7 @@ private:
 	void make_group_changed(const StringName &p_group);
 
 	void _notify_group_pause(const StringName &p_group, int p_notification);
+	void _process_thread_group(uint32_t p_index, ProcessThreadGroupPass *p_pass);
 	void _call_group_flags(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	void _call_group(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
@@ -197,7 +246,14 @@ private:
 	friend class Node3D;
 	friend class Viewport;
 
+	friend class Node2D;
+
 	SelfList<Node>::List xform_change_list;
+	SelfList<Node2D>::List canvas_transform_sync_list;
+	bool canvas_transform_batching = false; // Only while processing, transforms changed outside of it are sent right away.
+	BinaryMutex xform_change_mutex; // Transforms can change from thread groups.
+
+	void _flush_canvas_transforms();
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -348,6 +404,10 @@ public:
 
 	void get_nodes_in_group(const StringName &p_group, List<Node *> *p_list);
 	Node *get_first_node_in_group(const StringName &p_group);
+	// Shares the group's nodes instead of copying them. Don't modify the group while holding on to it for long,
+	// as that makes the group copy its nodes.
+	Vector<Node *> get_group_nodes(const StringName &p_group);
+	int get_node_count_in_group(const StringName &p_group) const;
 	bool has_group(const StringName &p_identifier) const;
 
 	//void change_scene(const String& p_path);
@@ -366,6 +426,18 @@ public:
 	Ref<Tween> create_tween();
 	TypedArray<Tween> get_processed_tweens();
 
+	void add_time_sliced_job(const Callable &p_callable, int p_priority = 0);
+	void remove_time_sliced_job(const Callable &p_callable);
+	bool has_time_sliced_job(const Callable &p_callable) const;
+	int get_time_sliced_job_count() const;
+
+	void set_time_slice_budget(double p_msec);
+	double get_time_slice_budget() const;
+
+	// Time used by the time-sliced jobs in the last frame, and number of frames in which they went over budget.
+	uint64_t get_time_slice_usage_usec() const { return time_slice_usage_usec; }
+	uint64_t get_time_slice_overrun_count() const { return time_slice_overrun_count; }
+
 	//used by Main::start, don't use otherwise
 	void add_current_scene(Node *p_current);
 
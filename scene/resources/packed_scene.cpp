@@ -50,7 +50,7 @@ bool SceneState::can_instantiate() const {
 }
 
 static Array _sanitize_node_pinned_properties(Node *p_node) {
-	Array pinned = p_node->get_meta("_edit_pinned_properties_", Array());
+	Array pinned = p_node->get_meta(SNAME("_edit_pinned_properties_"), Array());
 	if (pinned.is_empty()) {
 		return Array();
 	}
@@ -65,7 +65,7 @@ static Array _sanitize_node_pinned_properties(Node *p_node) {
 		}
 	} while (i < pinned.size());
 	if (pinned.is_empty()) {
-		p_node->remove_meta("_edit_pinned_properties_");
+		p_node->remove_meta(SNAME("_edit_pinned_properties_"));
 	}
 	return pinned;
 }
@@ -111,6 +111,9 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
 
+	// Shared by all nodes, only replaced once it has been handed over to a node.
+	Dictionary missing_resource_properties;
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
 
@@ -229,8 +232,6 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			if (nprop_count) {
 				const NodeData::Property *nprops = &n.properties[0];
 
-				Dictionary missing_resource_properties;
-
 				for (int j = 0; j < nprop_count; j++) {
 					bool valid;
 
@@ -334,6 +335,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 				}
 				if (!missing_resource_properties.is_empty()) {
 					node->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+					missing_resource_properties = Dictionary();
 				}
 			}
 
@@ -386,7 +388,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			if (p_edit_state == GEN_EDIT_STATE_MAIN) {
 				_sanitize_node_pinned_properties(node);
 			} else {
-				node->remove_meta("_edit_pinned_properties_");
+				node->remove_meta(SNAME("_edit_pinned_properties_"));
 			}
 		}
 
@@ -396,6 +398,11 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 		ret_nodes[i] = node;
 
+		if (i == 0 && node) {
+			// Most nodes of the scene end up owned by its root, so grow its owned list once.
+			node->data.owned.reserve(node->data.owned.size() + nc - 1);
+		}
+
 		if (node && gen_node_path_cache && ret_nodes[0]) {
 			NodePath n2 = ret_nodes[0]->get_path_to(node);
 			node_path_cache[n2] = i;
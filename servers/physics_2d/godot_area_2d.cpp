@@ -73,24 +73,33 @@ void GodotArea2D::set_space(GodotSpace2D *p_space) {
 
 	monitored_bodies.clear();
 	monitored_areas.clear();
+	overlapping_bodies.clear();
+	overlapping_areas.clear();
 
 	_set_space(p_space);
 }
 
-void GodotArea2D::set_monitor_callback(const Callable &p_callback) {
+void GodotArea2D::_set_monitor_callback(Callable &r_monitor_callback, const Callable &p_other_callback, const Callable &p_callback) {
 	ObjectID id = p_callback.get_object_id();
+	if (id == r_monitor_callback.get_object_id()) {
+		r_monitor_callback = p_callback;
+		return;
+	}
 
-	if (id == monitor_callback.get_object_id()) {
-		monitor_callback = p_callback;
+	if (!p_other_callback.is_null()) {
+		// The overlaps are already tracked for the other callback, registering again would report them as new.
+		r_monitor_callback = p_callback;
 		return;
 	}
 
 	_unregister_shapes();
 
-	monitor_callback = p_callback;
+	r_monitor_callback = p_callback;
 
 	monitored_bodies.clear();
 	monitored_areas.clear();
+	overlapping_bodies.clear();
+	overlapping_areas.clear();
 
 	_shape_changed();
 
@@ -99,26 +108,20 @@ void GodotArea2D::set_monitor_callback(const Callable &p_callback) {
 	}
 }
 
-void GodotArea2D::set_area_monitor_callback(const Callable &p_callback) {
-	ObjectID id = p_callback.get_object_id();
-
-	if (id == area_monitor_callback.get_object_id()) {
-		area_monitor_callback = p_callback;
-		return;
-	}
-
-	_unregister_shapes();
-
-	area_monitor_callback = p_callback;
+void GodotArea2D::set_monitor_callback(const Callable &p_callback) {
+	_set_monitor_callback(monitor_callback, monitor_batch_callback, p_callback);
+}
 
-	monitored_bodies.clear();
-	monitored_areas.clear();
+void GodotArea2D::set_monitor_batch_callback(const Callable &p_callback) {
+	_set_monitor_callback(monitor_batch_callback, monitor_callback, p_callback);
+}
 
-	_shape_changed();
+void GodotArea2D::set_area_monitor_callback(const Callable &p_callback) {
+	_set_monitor_callback(area_monitor_callback, area_monitor_batch_callback, p_callback);
+}
 
-	if (!moved_list.in_list() && get_space()) {
-		get_space()->area_add_to_moved_list(&moved_list);
-	}
+void GodotArea2D::set_area_monitor_batch_callback(const Callable &p_callback) {
+	_set_monitor_callback(area_monitor_batch_callback, area_monitor_callback, p_callback);
 }
 
 void GodotArea2D::_set_space_override_mode(PhysicsServer2D::AreaSpaceOverrideMode &r_mode, PhysicsServer2D::AreaSpaceOverrideMode p_new_mode) {
@@ -216,90 +219,96 @@ void GodotArea2D::set_monitorable(bool p_monitorable) {
 	_shapes_changed();
 }
 
-void GodotArea2D::call_queries() {
-	if (!monitor_callback.is_null() && !monitored_bodies.is_empty()) {
-		if (monitor_callback.is_valid()) {
-			Variant res[5];
-			Variant *resptr[5];
-			for (int i = 0; i < 5; i++) {
-				resptr[i] = &res[i];
-			}
+void GodotArea2D::_flush_monitor_events(HashMap<BodyKey, BodyState, BodyKey> &r_monitored, Callable &r_callback, Callable &r_batch_callback, HashMap<RID, int> &r_overlapping, const char *p_callback_name) {
+	if (r_monitored.is_empty()) {
+		return;
+	}
 
-			for (HashMap<BodyKey, BodyState, BodyKey>::Iterator E = monitored_bodies.begin(); E;) {
-				if (E->value.state == 0) { // Nothing happened
-					HashMap<BodyKey, BodyState, BodyKey>::Iterator next = E;
-					++next;
-					monitored_bodies.remove(E);
-					E = next;
-					continue;
-				}
-
-				res[0] = E->value.state > 0 ? PhysicsServer2D::AREA_BODY_ADDED : PhysicsServer2D::AREA_BODY_REMOVED;
-				res[1] = E->key.rid;
-				res[2] = E->key.instance_id;
-				res[3] = E->key.body_shape;
-				res[4] = E->key.area_shape;
-
-				HashMap<BodyKey, BodyState, BodyKey>::Iterator next = E;
-				++next;
-				monitored_bodies.remove(E);
-				E = next;
-
-				Callable::CallError ce;
-				Variant ret;
-				monitor_callback.callp((const Variant **)resptr, 5, ret, ce);
-
-				if (ce.error != Callable::CallError::CALL_OK) {
-					ERR_PRINT_ONCE("Error calling event callback method " + Variant::get_callable_error_text(monitor_callback, (const Variant **)resptr, 5, ce));
-				}
-			}
+	if (!r_callback.is_null() && !r_callback.is_valid()) {
+		r_callback = Callable();
+	}
+	if (!r_batch_callback.is_null() && !r_batch_callback.is_valid()) {
+		r_batch_callback = Callable();
+	}
+
+	// Gathered before calling anything, as the callbacks may change what is monitored.
+	PackedInt32Array statuses;
+	Array rids;
+	PackedInt64Array instance_ids;
+	PackedInt32Array object_shapes;
+	PackedInt32Array area_shapes;
+
+	for (const KeyValue<BodyKey, BodyState> &E : r_monitored) {
+		if (E.value.state == 0) { // Nothing happened
+			continue;
+		}
+
+		if (E.value.state > 0) {
+			statuses.push_back(PhysicsServer2D::AREA_BODY_ADDED);
+			r_overlapping[E.key.rid]++;
 		} else {
-			monitored_bodies.clear();
-			monitor_callback = Callable();
+			statuses.push_back(PhysicsServer2D::AREA_BODY_REMOVED);
+			HashMap<RID, int>::Iterator O = r_overlapping.find(E.key.rid);
+			if (O && --O->value <= 0) {
+				r_overlapping.remove(O);
+			}
 		}
+		rids.push_back(E.key.rid);
+		instance_ids.push_back(E.key.instance_id);
+		object_shapes.push_back(E.key.body_shape);
+		area_shapes.push_back(E.key.area_shape);
 	}
 
-	if (!area_monitor_callback.is_null() && !monitored_areas.is_empty()) {
-		if (area_monitor_callback.is_valid()) {
-			Variant res[5];
-			Variant *resptr[5];
-			for (int i = 0; i < 5; i++) {
-				resptr[i] = &res[i];
-			}
+	r_monitored.clear();
+
+	if (statuses.is_empty()) {
+		return;
+	}
+
+	if (!r_callback.is_null()) {
+		Variant res[5];
+		Variant *resptr[5];
+		for (int i = 0; i < 5; i++) {
+			resptr[i] = &res[i];
+		}
+
+		for (int i = 0; i < statuses.size(); i++) {
+			res[0] = statuses[i];
+			res[1] = rids[i];
+			res[2] = ObjectID(instance_ids[i]);
+			res[3] = object_shapes[i];
+			res[4] = area_shapes[i];
 
-			for (HashMap<BodyKey, BodyState, BodyKey>::Iterator E = monitored_areas.begin(); E;) {
-				if (E->value.state == 0) { // Nothing happened
-					HashMap<BodyKey, BodyState, BodyKey>::Iterator next = E;
-					++next;
-					monitored_areas.remove(E);
-					E = next;
-					continue;
-				}
-
-				res[0] = E->value.state > 0 ? PhysicsServer2D::AREA_BODY_ADDED : PhysicsServer2D::AREA_BODY_REMOVED;
-				res[1] = E->key.rid;
-				res[2] = E->key.instance_id;
-				res[3] = E->key.body_shape;
-				res[4] = E->key.area_shape;
-
-				HashMap<BodyKey, BodyState, BodyKey>::Iterator next = E;
-				++next;
-				monitored_areas.remove(E);
-				E = next;
-
-				Callable::CallError ce;
-				Variant ret;
-				area_monitor_callback.callp((const Variant **)resptr, 5, ret, ce);
-
-				if (ce.error != Callable::CallError::CALL_OK) {
-					ERR_PRINT_ONCE("Error calling event callback method " + Variant::get_callable_error_text(area_monitor_callback, (const Variant **)resptr, 5, ce));
-				}
+			Callable::CallError ce;
+			Variant ret;
+			r_callback.callp((const Variant **)resptr, 5, ret, ce);
+
+			if (ce.error != Callable::CallError::CALL_OK) {
+				ERR_PRINT_ONCE(vformat("Error calling %s method ", p_callback_name) + Variant::get_callable_error_text(r_callback, (const Variant **)resptr, 5, ce));
 			}
-		} else {
-			monitored_areas.clear();
-			area_monitor_callback = Callable();
 		}
 	}
+
+	if (!r_batch_callback.is_null()) {
+		Variant res[5] = { statuses, rids, instance_ids, object_shapes, area_shapes };
+		const Variant *resptr[5];
+		for (int i = 0; i < 5; i++) {
+			resptr[i] = &res[i];
+		}
+
+		Callable::CallError ce;
+		Variant ret;
+		r_batch_callback.callp(resptr, 5, ret, ce);
+
+		if (ce.error != Callable::CallError::CALL_OK) {
+			ERR_PRINT_ONCE(vformat("Error calling batched %s method ", p_callback_name) + Variant::get_callable_error_text(r_batch_callback, resptr, 5, ce));
+		}
+	}
+}
+
+void GodotArea2D::call_queries() {
+	_flush_monitor_events(monitored_bodies, monitor_callback, monitor_batch_callback, overlapping_bodies, "event callback");
+	_flush_monitor_events(monitored_areas, area_monitor_callback, area_monitor_batch_callback, overlapping_areas, "event callback");
 }
 
 void GodotArea2D::compute_gravity(const Vector2 &p_position, Vector2 &r_gravity) const {
@@ -59,6 +59,10 @@ class GodotArea2D : public GodotCollisionObject2D {
 
 	Callable area_monitor_callback;
 
+	// Called once per step with all the events of the step, as packed arrays.
+	Callable monitor_batch_callback;
+	Callable area_monitor_batch_callback;
+
 	SelfList<GodotArea2D> monitor_query_list;
 	SelfList<GodotArea2D> moved_list;
 
@@ -93,19 +97,30 @@ class GodotArea2D : public GodotCollisionObject2D {
 	HashMap<BodyKey, BodyState, BodyKey> monitored_bodies;
 	HashMap<BodyKey, BodyState, BodyKey> monitored_areas;
 
+	// Number of shape pairs overlapping each body or area, as of the last flushed events.
+	HashMap<RID, int> overlapping_bodies;
+	HashMap<RID, int> overlapping_areas;
+
 	HashSet<GodotConstraint2D *> constraints;
 
 	virtual void _shapes_changed() override;
 	void _queue_monitor_update();
+	void _set_monitor_callback(Callable &r_monitor_callback, const Callable &p_other_callback, const Callable &p_callback);
+	void _flush_monitor_events(HashMap<BodyKey, BodyState, BodyKey> &r_monitored, Callable &r_callback, Callable &r_batch_callback, HashMap<RID, int> &r_overlapping, const char *p_callback_name);
 
 	void _set_space_override_mode(PhysicsServer2D::AreaSpaceOverrideMode &r_mode, PhysicsServer2D::AreaSpaceOverrideMode p_new_mode);
 
 public:
 	void set_monitor_callback(const Callable &p_callback);
-	_FORCE_INLINE_ bool has_monitor_callback() const { return !monitor_callback.is_null(); }
+	void set_monitor_batch_callback(const Callable &p_callback);
+	_FORCE_INLINE_ bool has_monitor_callback() const { return !monitor_callback.is_null() || !monitor_batch_callback.is_null(); }
 
 	void set_area_monitor_callback(const Callable &p_callback);
-	_FORCE_INLINE_ bool has_area_monitor_callback() const { return !area_monitor_callback.is_null(); }
+	void set_area_monitor_batch_callback(const Callable &p_callback);
+	_FORCE_INLINE_ bool has_area_monitor_callback() const { return !area_monitor_callback.is_null() || !area_monitor_batch_callback.is_null(); }
+
+	_FORCE_INLINE_ const HashMap<RID, int> &get_overlapping_bodies() const { return overlapping_bodies; }
+	_FORCE_INLINE_ const HashMap<RID, int> &get_overlapping_areas() const { return overlapping_areas; }
 
 	_FORCE_INLINE_ void add_body_to_query(GodotBody2D *p_body, uint32_t p_body_shape, uint32_t p_area_shape);
 	_FORCE_INLINE_ void remove_body_from_query(GodotBody2D *p_body, uint32_t p_body_shape, uint32_t p_area_shape);
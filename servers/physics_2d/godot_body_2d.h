@@ -106,6 +106,12 @@ class GodotBody2D : public GodotCollisionObject2D {
 	virtual void _shapes_changed() override;
 	Transform2D new_transform;
 
+	// Left for finish_integrate_forces() and finish_integrate_velocities().
+	Vector2 integrated_motion;
+	bool integrated_motion_pending = false;
+	bool integrated_shapes_pending = false;
+	bool integrated_deactivate_pending = false;
+
 	List<Pair<GodotConstraint2D *, int>> constraint_list;
 
 	struct AreaCMP {
@@ -313,8 +319,12 @@ public:
 	_FORCE_INLINE_ real_t get_friction() const { return friction; }
 	_FORCE_INLINE_ real_t get_bounce() const { return bounce; }
 
+	// These only touch this body, so they can run for several bodies in parallel.
+	// Their changes to the broadphase and to the space lists are applied afterwards by the finish functions, serially.
 	void integrate_forces(real_t p_step);
+	void finish_integrate_forces();
 	void integrate_velocities(real_t p_step);
+	void finish_integrate_velocities();
 
 	_FORCE_INLINE_ Vector2 get_velocity_in_local_point(const Vector2 &rel_pos) const {
 		return linear_velocity + Vector2(-angular_velocity * rel_pos.y, angular_velocity * rel_pos.x);
@@ -34,12 +34,34 @@
 #include "godot_body_2d.h"
 
 class GodotConstraint2D {
+public:
+	// Canonical solve order used by deterministic spaces. Built from RID ids,
+	// which are handed out in creation order, so it doesn't depend on memory
+	// addresses or on the order the broadphase reports pairs in.
+	struct SortKey {
+		uint64_t a = 0;
+		uint64_t b = 0;
+		uint64_t c = 0;
+
+		_FORCE_INLINE_ bool operator<(const SortKey &p_other) const {
+			if (a != p_other.a) {
+				return a < p_other.a;
+			}
+			if (b != p_other.b) {
+				return b < p_other.b;
+			}
+			return c < p_other.c;
+		}
+	};
+
+private:
 	GodotBody2D **_body_ptr;
 	int _body_count;
 	uint64_t island_step = 0;
 	bool disabled_collisions_between_bodies = true;
 
 	RID self;
+	SortKey sort_key;
 
 protected:
 	GodotConstraint2D(GodotBody2D **p_body_ptr = nullptr, int p_body_count = 0) {
@@ -48,9 +70,15 @@ protected:
 	}
 
 public:
-	_FORCE_INLINE_ void set_self(const RID &p_self) { self = p_self; }
+	_FORCE_INLINE_ void set_self(const RID &p_self) {
+		self = p_self;
+		sort_key.a = p_self.get_id();
+	}
 	_FORCE_INLINE_ RID get_self() const { return self; }
 
+	_FORCE_INLINE_ void set_sort_key(const SortKey &p_key) { sort_key = p_key; }
+	_FORCE_INLINE_ const SortKey &get_sort_key() const { return sort_key; }
+
 	_FORCE_INLINE_ uint64_t get_island_step() const { return island_step; }
 	_FORCE_INLINE_ void set_island_step(uint64_t p_step) { island_step = p_step; }
 
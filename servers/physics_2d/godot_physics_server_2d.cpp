@@ -527,6 +527,42 @@ void GodotPhysicsServer2D::area_set_area_monitor_callback(RID p_area, const Call
 	area->set_area_monitor_callback(p_callback.is_valid() ? p_callback : Callable());
 }
 
+void GodotPhysicsServer2D::area_set_monitor_batch_callback(RID p_area, const Callable &p_callback) {
+	GodotArea2D *area = area_owner.get_or_null(p_area);
+	ERR_FAIL_COND(!area);
+
+	area->set_monitor_batch_callback(p_callback.is_valid() ? p_callback : Callable());
+}
+
+void GodotPhysicsServer2D::area_set_area_monitor_batch_callback(RID p_area, const Callable &p_callback) {
+	GodotArea2D *area = area_owner.get_or_null(p_area);
+	ERR_FAIL_COND(!area);
+
+	area->set_area_monitor_batch_callback(p_callback.is_valid() ? p_callback : Callable());
+}
+
+Vector<RID> GodotPhysicsServer2D::area_get_overlapping_bodies(RID p_area) const {
+	GodotArea2D *area = area_owner.get_or_null(p_area);
+	ERR_FAIL_COND_V(!area, Vector<RID>());
+
+	Vector<RID> ret;
+	for (const KeyValue<RID, int> &E : area->get_overlapping_bodies()) {
+		ret.push_back(E.key);
+	}
+	return ret;
+}
+
+Vector<RID> GodotPhysicsServer2D::area_get_overlapping_areas(RID p_area) const {
+	GodotArea2D *area = area_owner.get_or_null(p_area);
+	ERR_FAIL_COND_V(!area, Vector<RID>());
+
+	Vector<RID> ret;
+	for (const KeyValue<RID, int> &E : area->get_overlapping_areas()) {
+		ret.push_back(E.key);
+	}
+	return ret;
+}
+
 /* BODY API */
 
 RID GodotPhysicsServer2D::body_create() {
@@ -781,6 +817,32 @@ Variant GodotPhysicsServer2D::body_get_state(RID p_body, BodyState p_state) cons
 	return body->get_state(p_state);
 }
 
+void GodotPhysicsServer2D::body_set_states(const Vector<RID> &p_bodies, BodyState p_state, const Vector<Variant> &p_values) {
+	ERR_FAIL_COND(p_bodies.size() != p_values.size());
+	const RID *bodies = p_bodies.ptr();
+	const Variant *values = p_values.ptr();
+	for (int i = 0; i < p_bodies.size(); i++) {
+		GodotBody2D *body = body_owner.get_or_null(bodies[i]);
+		ERR_CONTINUE(!body);
+
+		body->set_state(p_state, values[i]);
+	}
+}
+
+Vector<Variant> GodotPhysicsServer2D::body_get_states(const Vector<RID> &p_bodies, BodyState p_state) const {
+	Vector<Variant> ret;
+	ret.resize(p_bodies.size());
+	const RID *bodies = p_bodies.ptr();
+	Variant *w = ret.ptrw();
+	for (int i = 0; i < p_bodies.size(); i++) {
+		GodotBody2D *body = body_owner.get_or_null(bodies[i]);
+		ERR_CONTINUE(!body);
+
+		w[i] = body->get_state(p_state);
+	}
+	return ret;
+}
+
 void GodotPhysicsServer2D::body_apply_central_impulse(RID p_body, const Vector2 &p_impulse) {
 	GodotBody2D *body = body_owner.get_or_null(p_body);
 	ERR_FAIL_COND(!body);
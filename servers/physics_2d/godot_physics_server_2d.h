@@ -160,6 +160,11 @@ public:
 
 	virtual void area_set_monitor_callback(RID p_area, const Callable &p_callback) override;
 	virtual void area_set_area_monitor_callback(RID p_area, const Callable &p_callback) override;
+	virtual void area_set_monitor_batch_callback(RID p_area, const Callable &p_callback) override;
+	virtual void area_set_area_monitor_batch_callback(RID p_area, const Callable &p_callback) override;
+
+	virtual Vector<RID> area_get_overlapping_bodies(RID p_area) const override;
+	virtual Vector<RID> area_get_overlapping_areas(RID p_area) const override;
 
 	virtual void area_set_pickable(RID p_area, bool p_pickable) override;
 
@@ -213,6 +218,8 @@ public:
 
 	virtual void body_set_state(RID p_body, BodyState p_state, const Variant &p_variant) override;
 	virtual Variant body_get_state(RID p_body, BodyState p_state) const override;
+	virtual void body_set_states(const Vector<RID> &p_bodies, BodyState p_state, const Vector<Variant> &p_values) override;
+	virtual Vector<Variant> body_get_states(const Vector<RID> &p_bodies, BodyState p_state) const override;
 
 	virtual void body_apply_central_impulse(RID p_body, const Vector2 &p_impulse) override;
 	virtual void body_apply_torque_impulse(RID p_body, real_t p_torque) override;
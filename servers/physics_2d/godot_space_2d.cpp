@@ -33,12 +33,16 @@
 #include "godot_collision_solver_2d.h"
 #include "godot_physics_server_2d.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/templates/pair.h"
 
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
 
+// Number of batched queries handled by one task.
+#define QUERY_BATCH_CHUNK_SIZE 64
+
 _FORCE_INLINE_ static bool _can_collide_with(GodotCollisionObject2D *p_object, uint32_t p_collision_mask, bool p_collide_with_bodies, bool p_collide_with_areas) {
 	if (!(p_object->get_collision_layer() & p_collision_mask)) {
 		return false;
@@ -55,6 +59,50 @@ _FORCE_INLINE_ static bool _can_collide_with(GodotCollisionObject2D *p_object, u
 	return true;
 }
 
+// Orders batched queries along a Morton curve through their starting points. Queries handled by the same
+// task are then close to each other, and mostly traverse the same broadphase nodes.
+static void _sort_queries_spatially(const Vector2 *p_points, uint32_t p_count, LocalVector<uint32_t> &r_order) {
+	struct MortonKey {
+		uint32_t code = 0;
+		uint32_t index = 0;
+
+		_FORCE_INLINE_ bool operator<(const MortonKey &p_other) const { return code < p_other.code; }
+
+		static _FORCE_INLINE_ uint32_t spread_bits(uint32_t p_value) {
+			p_value &= 0xffff;
+			p_value = (p_value | (p_value << 8)) & 0x00ff00ff;
+			p_value = (p_value | (p_value << 4)) & 0x0f0f0f0f;
+			p_value = (p_value | (p_value << 2)) & 0x33333333;
+			p_value = (p_value | (p_value << 1)) & 0x55555555;
+			return p_value;
+		}
+	};
+
+	Rect2 bounds(p_points[0], Vector2());
+	for (uint32_t i = 1; i < p_count; i++) {
+		bounds.expand_to(p_points[i]);
+	}
+
+	Vector2 scale;
+	for (int axis = 0; axis < 2; axis++) {
+		scale[axis] = bounds.size[axis] > CMP_EPSILON ? 65535.0 / bounds.size[axis] : 0.0;
+	}
+
+	LocalVector<MortonKey> keys;
+	keys.resize(p_count);
+	for (uint32_t i = 0; i < p_count; i++) {
+		Vector2 cell = (p_points[i] - bounds.position) * scale;
+		keys[i].code = MortonKey::spread_bits(uint32_t(cell.x)) | (MortonKey::spread_bits(uint32_t(cell.y)) << 1);
+		keys[i].index = i;
+	}
+	keys.sort();
+
+	r_order.resize(p_count);
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_order[i] = keys[i].index;
+	}
+}
+
 int GodotPhysicsDirectSpaceState2D::intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
 	if (p_result_max <= 0) {
 		return 0;
@@ -114,16 +162,19 @@ int GodotPhysicsDirectSpaceState2D::intersect_point(const PointParameters &p_par
 	return cc;
 }
 
-bool GodotPhysicsDirectSpaceState2D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
-	ERR_FAIL_COND_V(space->locked, false);
-
+bool GodotPhysicsDirectSpaceState2D::_intersect_ray(const RayParameters &p_parameters, const Vector2 &p_from, const Vector2 &p_to, RayResult &r_result, const QueryBuffer &p_buffer) const {
 	Vector2 begin, end;
 	Vector2 normal;
-	begin = p_parameters.from;
-	end = p_parameters.to;
+	begin = p_from;
+	end = p_to;
 	normal = (end - begin).normalized();
 
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, GodotSpace2D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	int amount;
+	if (p_buffer.concurrent) {
+		amount = space->broadphase->cull_segment_concurrent(begin, end, p_buffer.objects, GodotSpace2D::INTERSECTION_QUERY_MAX, p_buffer.subindices);
+	} else {
+		amount = space->broadphase->cull_segment(begin, end, p_buffer.objects, GodotSpace2D::INTERSECTION_QUERY_MAX, p_buffer.subindices);
+	}
 
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
@@ -134,17 +185,17 @@ bool GodotPhysicsDirectSpaceState2D::intersect_ray(const RayParameters &p_parame
 	real_t min_d = 1e10;
 
 	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(p_buffer.objects[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_buffer.objects[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject2D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject2D *col_obj = p_buffer.objects[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = p_buffer.subindices[i];
 		Transform2D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
 		Vector2 local_from = inv_xform.xform(begin);
@@ -204,19 +255,71 @@ bool GodotPhysicsDirectSpaceState2D::intersect_ray(const RayParameters &p_parame
 	return true;
 }
 
-int GodotPhysicsDirectSpaceState2D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
-	if (p_result_max <= 0) {
-		return 0;
+bool GodotPhysicsDirectSpaceState2D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
+	ERR_FAIL_COND_V(space->locked, false);
+
+	QueryBuffer buffer;
+	buffer.objects = space->intersection_query_results;
+	buffer.subindices = space->intersection_query_subindex_results;
+	return _intersect_ray(p_parameters, p_parameters.from, p_parameters.to, r_result, buffer);
+}
+
+void GodotPhysicsDirectSpaceState2D::_intersect_ray_chunk(uint32_t p_chunk, RayBatch *p_batch) {
+	LocalVector<GodotCollisionObject2D *> objects;
+	LocalVector<int> subindices;
+	objects.resize(GodotSpace2D::INTERSECTION_QUERY_MAX);
+	subindices.resize(GodotSpace2D::INTERSECTION_QUERY_MAX);
+
+	QueryBuffer buffer;
+	buffer.objects = objects.ptr();
+	buffer.subindices = subindices.ptr();
+	buffer.concurrent = true;
+
+	uint32_t end = MIN((p_chunk + 1) * QUERY_BATCH_CHUNK_SIZE, p_batch->count);
+	for (uint32_t i = p_chunk * QUERY_BATCH_CHUNK_SIZE; i < end; i++) {
+		uint32_t query = p_batch->order[i];
+		p_batch->hits[query] = _intersect_ray(*p_batch->parameters, p_batch->from[query], p_batch->to[query], p_batch->results[query], buffer);
 	}
+}
 
-	GodotShape2D *shape = GodotPhysicsServer2D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
-	ERR_FAIL_COND_V(!shape, 0);
+void GodotPhysicsDirectSpaceState2D::intersect_rays(const RayParameters &p_parameters, const Vector2 *p_from, const Vector2 *p_to, int p_count, RayResult *r_results, bool *r_hits) {
+	if (p_count <= 0) {
+		return;
+	}
+	// Cleared up front so that the failure paths still leave valid results.
+	for (int i = 0; i < p_count; i++) {
+		r_hits[i] = false;
+	}
+	ERR_FAIL_COND(space->locked);
+
+	LocalVector<uint32_t> order;
+	_sort_queries_spatially(p_from, p_count, order);
+
+	RayBatch batch;
+	batch.parameters = &p_parameters;
+	batch.from = p_from;
+	batch.to = p_to;
+	batch.results = r_results;
+	batch.hits = r_hits;
+	batch.order = order.ptr();
+	batch.count = p_count;
+
+	uint32_t chunk_count = (p_count + QUERY_BATCH_CHUNK_SIZE - 1) / QUERY_BATCH_CHUNK_SIZE;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState2D::_intersect_ray_chunk, &batch, chunk_count, -1, true, SNAME("Physics2DIntersectRays"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
 
-	Rect2 aabb = p_parameters.transform.xform(shape->get_aabb());
+int GodotPhysicsDirectSpaceState2D::_intersect_shape(const ShapeParameters &p_parameters, const GodotShape2D *p_shape, const Transform2D &p_transform, ShapeResult *r_results, int p_result_max, const QueryBuffer &p_buffer) const {
+	Rect2 aabb = p_transform.xform(p_shape->get_aabb());
 	aabb = aabb.merge(Rect2(aabb.position + p_parameters.motion, aabb.size)); //motion
 	aabb = aabb.grow(p_parameters.margin);
 
-	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace2D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	int amount;
+	if (p_buffer.concurrent) {
+		amount = space->broadphase->cull_aabb_concurrent(aabb, p_buffer.objects, GodotSpace2D::INTERSECTION_QUERY_MAX, p_buffer.subindices);
+	} else {
+		amount = space->broadphase->cull_aabb(aabb, p_buffer.objects, GodotSpace2D::INTERSECTION_QUERY_MAX, p_buffer.subindices);
+	}
 
 	int cc = 0;
 
@@ -225,18 +328,18 @@ int GodotPhysicsDirectSpaceState2D::intersect_shape(const ShapeParameters &p_par
 			break;
 		}
 
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(p_buffer.objects[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_buffer.objects[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject2D *col_obj = space->intersection_query_results[i];
-		int shape_idx = space->intersection_query_subindex_results[i];
+		const GodotCollisionObject2D *col_obj = p_buffer.objects[i];
+		int shape_idx = p_buffer.subindices[i];
 
-		if (!GodotCollisionSolver2D::solve(shape, p_parameters.transform, p_parameters.motion, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), Vector2(), nullptr, nullptr, nullptr, p_parameters.margin)) {
+		if (!GodotCollisionSolver2D::solve(p_shape, p_transform, p_parameters.motion, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), Vector2(), nullptr, nullptr, nullptr, p_parameters.margin)) {
 			continue;
 		}
 
@@ -253,6 +356,79 @@ int GodotPhysicsDirectSpaceState2D::intersect_shape(const ShapeParameters &p_par
 	return cc;
 }
 
+int GodotPhysicsDirectSpaceState2D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
+	if (p_result_max <= 0) {
+		return 0;
+	}
+
+	GodotShape2D *shape = GodotPhysicsServer2D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_COND_V(!shape, 0);
+
+	QueryBuffer buffer;
+	buffer.objects = space->intersection_query_results;
+	buffer.subindices = space->intersection_query_subindex_results;
+	return _intersect_shape(p_parameters, shape, p_parameters.transform, r_results, p_result_max, buffer);
+}
+
+void GodotPhysicsDirectSpaceState2D::_intersect_shape_chunk(uint32_t p_chunk, ShapeBatch *p_batch) {
+	LocalVector<GodotCollisionObject2D *> objects;
+	LocalVector<int> subindices;
+	objects.resize(GodotSpace2D::INTERSECTION_QUERY_MAX);
+	subindices.resize(GodotSpace2D::INTERSECTION_QUERY_MAX);
+
+	QueryBuffer buffer;
+	buffer.objects = objects.ptr();
+	buffer.subindices = subindices.ptr();
+	buffer.concurrent = true;
+
+	uint32_t end = MIN((p_chunk + 1) * QUERY_BATCH_CHUNK_SIZE, p_batch->count);
+	for (uint32_t i = p_chunk * QUERY_BATCH_CHUNK_SIZE; i < end; i++) {
+		uint32_t query = p_batch->order[i];
+		ShapeResult *results = p_batch->results ? p_batch->results + query * p_batch->result_max : nullptr;
+		p_batch->result_counts[query] = _intersect_shape(*p_batch->parameters, p_batch->shape, p_batch->transforms[query], results, p_batch->result_max, buffer);
+	}
+}
+
+void GodotPhysicsDirectSpaceState2D::intersect_shapes(const ShapeParameters &p_parameters, const Transform2D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	if (p_count <= 0) {
+		return;
+	}
+	// Cleared up front so that the failure paths still leave valid results.
+	for (int i = 0; i < p_count; i++) {
+		r_result_counts[i] = 0;
+	}
+	ERR_FAIL_COND(space->locked);
+	if (p_result_max <= 0) {
+		return;
+	}
+
+	GodotShape2D *shape = GodotPhysicsServer2D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_COND(!shape);
+
+	LocalVector<Vector2> origins;
+	origins.resize(p_count);
+	for (int i = 0; i < p_count; i++) {
+		origins[i] = p_transforms[i].get_origin();
+	}
+
+	LocalVector<uint32_t> order;
+	_sort_queries_spatially(origins.ptr(), p_count, order);
+
+	ShapeBatch batch;
+	batch.parameters = &p_parameters;
+	batch.shape = shape;
+	batch.transforms = p_transforms;
+	batch.results = r_results;
+	batch.result_max = p_result_max;
+	batch.result_counts = r_result_counts;
+	batch.order = order.ptr();
+	batch.count = p_count;
+
+	uint32_t chunk_count = (p_count + QUERY_BATCH_CHUNK_SIZE - 1) / QUERY_BATCH_CHUNK_SIZE;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState2D::_intersect_shape_chunk, &batch, chunk_count, -1, true, SNAME("Physics2DIntersectShapes"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 bool GodotPhysicsDirectSpaceState2D::cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe) {
 	GodotShape2D *shape = GodotPhysicsServer2D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
 	ERR_FAIL_COND_V(!shape, false);
@@ -1009,6 +1185,21 @@ bool GodotSpace2D::test_body_motion(GodotBody2D *p_body, const PhysicsServer2D::
 }
 
 // Assumes a valid collision pair, this should have been checked beforehand in the BVH or octree.
+static GodotConstraint2D::SortKey _get_pair_sort_key(const GodotCollisionObject2D *p_A, int p_subindex_A, const GodotCollisionObject2D *p_B, int p_subindex_B) {
+	uint64_t id_A = p_A->get_self().get_id();
+	uint64_t id_B = p_B->get_self().get_id();
+	if (id_A > id_B) {
+		SWAP(id_A, id_B);
+		SWAP(p_subindex_A, p_subindex_B);
+	}
+
+	GodotConstraint2D::SortKey key;
+	key.a = id_A;
+	key.b = id_B;
+	key.c = (uint64_t(uint32_t(p_subindex_A)) << 32) | uint64_t(uint32_t(p_subindex_B));
+	return key;
+}
+
 void *GodotSpace2D::_broadphase_pair(GodotCollisionObject2D *A, int p_subindex_A, GodotCollisionObject2D *B, int p_subindex_B, void *p_self) {
 	GodotCollisionObject2D::Type type_A = A->get_type();
 	GodotCollisionObject2D::Type type_B = B->get_type();
@@ -1021,22 +1212,24 @@ void *GodotSpace2D::_broadphase_pair(GodotCollisionObject2D *A, int p_subindex_A
 	GodotSpace2D *self = static_cast<GodotSpace2D *>(p_self);
 	self->collision_pairs++;
 
+	GodotConstraint2D *constraint = nullptr;
+
 	if (type_A == GodotCollisionObject2D::TYPE_AREA) {
 		GodotArea2D *area = static_cast<GodotArea2D *>(A);
 		if (type_B == GodotCollisionObject2D::TYPE_AREA) {
 			GodotArea2D *area_b = static_cast<GodotArea2D *>(B);
-			GodotArea2Pair2D *area2_pair = memnew(GodotArea2Pair2D(area_b, p_subindex_B, area, p_subindex_A));
-			return area2_pair;
+			constraint = memnew(GodotArea2Pair2D(area_b, p_subindex_B, area, p_subindex_A));
 		} else {
 			GodotBody2D *body = static_cast<GodotBody2D *>(B);
-			GodotAreaPair2D *area_pair = memnew(GodotAreaPair2D(body, p_subindex_B, area, p_subindex_A));
-			return area_pair;
+			constraint = memnew(GodotAreaPair2D(body, p_subindex_B, area, p_subindex_A));
 		}
 
 	} else {
-		GodotBodyPair2D *b = memnew(GodotBodyPair2D(static_cast<GodotBody2D *>(A), p_subindex_A, static_cast<GodotBody2D *>(B), p_subindex_B));
-		return b;
+		constraint = memnew(GodotBodyPair2D(static_cast<GodotBody2D *>(A), p_subindex_A, static_cast<GodotBody2D *>(B), p_subindex_B));
 	}
+
+	constraint->set_sort_key(_get_pair_sort_key(A, p_subindex_A, B, p_subindex_B));
+	return constraint;
 }
 
 void GodotSpace2D::_broadphase_unpair(GodotCollisionObject2D *A, int p_subindex_A, GodotCollisionObject2D *B, int p_subindex_B, void *p_data, void *p_self) {
@@ -1223,6 +1416,7 @@ GodotSpace2D::GodotSpace2D() {
 
 	solver_iterations = GLOBAL_DEF("physics/2d/solver/solver_iterations", 16);
 	ProjectSettings::get_singleton()->set_custom_property_info("physics/2d/solver/solver_iterations", PropertyInfo(Variant::INT, "physics/2d/solver/solver_iterations", PROPERTY_HINT_RANGE, "1,32,1,or_greater"));
+	deterministic = GLOBAL_DEF("physics/2d/solver/deterministic", false);
 
 	contact_recycle_radius = GLOBAL_DEF("physics/2d/solver/contact_recycle_radius", 1.0);
 	ProjectSettings::get_singleton()->set_custom_property_info("physics/2d/solver/contact_recycle_radius", PropertyInfo(Variant::FLOAT, "physics/2d/solver/contact_recycle_radius", PROPERTY_HINT_RANGE, "0,10,0.01,or_greater"));
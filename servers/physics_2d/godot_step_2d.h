@@ -40,13 +40,27 @@ class GodotStep2D {
 	uint64_t _step = 1;
 
 	int iterations = 0;
+	bool deterministic = false;
 	real_t delta = 0.0;
 
 	LocalVector<LocalVector<GodotBody2D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint2D *>> constraint_islands;
 	LocalVector<GodotConstraint2D *> all_constraints;
+	LocalVector<GodotBody2D *> active_bodies;
+
+	struct IslandOrder {
+		GodotConstraint2D::SortKey key;
+		uint32_t index = 0;
+
+		_FORCE_INLINE_ bool operator<(const IslandOrder &p_other) const { return key < p_other.key; }
+	};
+	LocalVector<IslandOrder> island_order;
 
 	void _populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island);
+	void _fill_active_bodies(const SelfList<GodotBody2D>::List *p_body_list);
+	void _sort_islands(uint32_t p_island_count);
+	void _integrate_forces(uint32_t p_body_index, void *p_userdata = nullptr);
+	void _integrate_velocities(uint32_t p_body_index, void *p_userdata = nullptr);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint2D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr) const;
@@ -181,11 +181,52 @@ void GodotBody3D::set_active(bool p_active) {
 		if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
 			// Static bodies can't be active.
 			active = false;
-		} else if (get_space()) {
+			return;
+		}
+		if (get_space()) {
 			get_space()->body_add_to_active_list(&active_list);
 		}
-	} else if (get_space()) {
-		get_space()->body_remove_from_active_list(&active_list);
+		if (is_sleeping()) {
+			_wakeup_island();
+		}
+	} else {
+		if (get_space()) {
+			get_space()->body_remove_from_active_list(&active_list);
+		}
+		if (mode >= PhysicsServer3D::BODY_MODE_RIGID) {
+			_set_sleeping(true);
+		}
+	}
+}
+
+void GodotBody3D::_wakeup_island() {
+	// Bodies that fell asleep together are still connected through their constraints,
+	// so the whole island is woken up at once.
+	_set_sleeping(false);
+
+	LocalVector<GodotBody3D *> island;
+	island.push_back(this);
+	for (uint32_t island_index = 0; island_index < island.size(); ++island_index) {
+		GodotBody3D *body = island[island_index];
+		for (const KeyValue<GodotConstraint3D *, int> &E : body->constraint_map) {
+			const GodotConstraint3D *c = E.key;
+			GodotBody3D **n = c->get_body_ptr();
+			int bc = c->get_body_count();
+
+			for (int i = 0; i < bc; i++) {
+				if (i == E.value) {
+					continue;
+				}
+				GodotBody3D *b = n[i];
+				if (!b->is_sleeping()) {
+					continue;
+				}
+				// Cleared first, so set_active() doesn't walk the island again.
+				b->_set_sleeping(false);
+				b->set_active(true);
+				island.push_back(b);
+			}
+		}
 	}
 }
 
@@ -305,6 +346,7 @@ void GodotBody3D::set_mode(PhysicsServer3D::BodyMode p_mode) {
 			_set_inv_transform(get_transform().affine_inverse());
 			_inv_mass = 0;
 			_inv_inertia = Vector3();
+			_set_sleeping(false);
 			_set_static(p_mode == PhysicsServer3D::BODY_MODE_STATIC);
 			set_active(p_mode == PhysicsServer3D::BODY_MODE_KINEMATIC && contacts.size());
 			linear_velocity = Vector3();
@@ -663,21 +705,25 @@ void GodotBody3D::integrate_forces(real_t p_step) {
 	biased_linear_velocity = Vector3();
 
 	if (do_motion) { //shapes temporarily extend for raycast
-		_update_shapes_with_motion(motion);
+		integrated_motion = motion;
+		integrated_motion_pending = true;
 	}
 
 	contact_count = 0;
 }
 
+void GodotBody3D::finish_integrate_forces() {
+	if (integrated_motion_pending) {
+		_update_shapes_with_motion(integrated_motion);
+		integrated_motion_pending = false;
+	}
+}
+
 void GodotBody3D::integrate_velocities(real_t p_step) {
 	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
 		return;
 	}
 
-	if (fi_callback_data || body_state_callback.get_object()) {
-		get_space()->body_add_to_state_query_list(&direct_state_query_list);
-	}
-
 	//apply axis lock linear
 	for (int i = 0; i < 3; i++) {
 		if (is_axis_locked((PhysicsServer3D::BodyAxis)(1 << i))) {
@@ -695,10 +741,11 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 	}
 
 	if (mode == PhysicsServer3D::BODY_MODE_KINEMATIC) {
+		ccd_motion_scale = 1.0; // Kinematic motion is never shortened.
 		_set_transform(new_transform, false);
 		_set_inv_transform(new_transform.affine_inverse());
 		if (contacts.size() == 0 && linear_velocity == Vector3() && angular_velocity == Vector3()) {
-			set_active(false); //stopped moving, deactivate
+			integrated_deactivate_pending = true; //stopped moving, deactivate
 		}
 
 		return;
@@ -725,12 +772,36 @@ void GodotBody3D::integrate_velocities(real_t p_step) {
 		}
 	}*/
 
-	transform_new.origin += total_linear_velocity * p_step;
+	// The velocity is kept when stopped short by CCD, so the contact solver can resolve the impact next step.
+	transform_new.origin += total_linear_velocity * p_step * ccd_motion_scale;
+	ccd_motion_scale = 1.0;
 
-	_set_transform(transform_new);
+	_set_transform(transform_new, false);
 	_set_inv_transform(get_transform().inverse());
 
 	_update_transform_dependent();
+
+	integrated_shapes_pending = true;
+}
+
+void GodotBody3D::finish_integrate_velocities() {
+	if (mode == PhysicsServer3D::BODY_MODE_STATIC) {
+		return;
+	}
+
+	if (fi_callback_data || body_state_callback.get_object()) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+
+	if (integrated_shapes_pending) {
+		_update_shapes();
+		integrated_shapes_pending = false;
+	}
+
+	if (integrated_deactivate_pending) {
+		set_active(false);
+		integrated_deactivate_pending = false;
+	}
 }
 
 void GodotBody3D::wakeup_neighbours() {
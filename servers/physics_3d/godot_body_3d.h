@@ -105,6 +105,7 @@ class GodotBody3D : public GodotCollisionObject3D {
 	bool active = true;
 
 	bool continuous_cd = false;
+	real_t ccd_motion_scale = 1.0; // Fraction of the linear motion left after a time of impact, for this step only.
 	bool can_sleep = true;
 	bool first_time_kinematic = false;
 
@@ -112,6 +113,12 @@ class GodotBody3D : public GodotCollisionObject3D {
 	virtual void _shapes_changed() override;
 	Transform3D new_transform;
 
+	// Left for finish_integrate_forces() and finish_integrate_velocities().
+	Vector3 integrated_motion;
+	bool integrated_motion_pending = false;
+	bool integrated_shapes_pending = false;
+	bool integrated_deactivate_pending = false;
+
 	HashMap<GodotConstraint3D *, int> constraint_map;
 
 	Vector<AreaCMP> areas;
@@ -145,6 +152,7 @@ class GodotBody3D : public GodotCollisionObject3D {
 	uint64_t island_step = 0;
 
 	void _update_transform_dependent();
+	void _wakeup_island();
 
 	friend class GodotPhysicsDirectBodyState3D; // i give up, too many functions to expose
 
@@ -227,6 +235,25 @@ public:
 		angular_velocity += _inv_inertia_tensor.xform((p_position - center_of_mass).cross(p_impulse));
 	}
 
+	// For impulses whose angular velocity change was already computed, e.g. by contacts which apply impulses
+	// along the same normal many times per step.
+	_FORCE_INLINE_ void apply_precomputed_impulse(const Vector3 &p_impulse, const Vector3 &p_delta_av) {
+		linear_velocity += p_impulse * _inv_mass;
+		angular_velocity += p_delta_av;
+	}
+
+	// Same as apply_bias_impulse(), p_max_delta_av is 0 for no angular bias and negative for no clamping.
+	_FORCE_INLINE_ void apply_precomputed_bias_impulse(const Vector3 &p_impulse, const Vector3 &p_delta_av, real_t p_max_delta_av = -1.0) {
+		biased_linear_velocity += p_impulse * _inv_mass;
+		if (p_max_delta_av != 0.0) {
+			if (p_max_delta_av > 0 && p_delta_av.length_squared() > p_max_delta_av * p_max_delta_av) {
+				biased_angular_velocity += p_delta_av.normalized() * p_max_delta_av;
+			} else {
+				biased_angular_velocity += p_delta_av;
+			}
+		}
+	}
+
 	_FORCE_INLINE_ void apply_torque_impulse(const Vector3 &p_impulse) {
 		angular_velocity += _inv_inertia_tensor.xform(p_impulse);
 	}
@@ -300,6 +327,9 @@ public:
 	_FORCE_INLINE_ void set_continuous_collision_detection(bool p_enable) { continuous_cd = p_enable; }
 	_FORCE_INLINE_ bool is_continuous_collision_detection_enabled() const { return continuous_cd; }
 
+	_FORCE_INLINE_ void set_ccd_motion_scale(real_t p_scale) { ccd_motion_scale = p_scale; }
+	_FORCE_INLINE_ real_t get_ccd_motion_scale() const { return ccd_motion_scale; }
+
 	void set_space(GodotSpace3D *p_space) override;
 
 	void update_mass_properties();
@@ -314,8 +344,12 @@ public:
 	void set_axis_lock(PhysicsServer3D::BodyAxis p_axis, bool lock);
 	bool is_axis_locked(PhysicsServer3D::BodyAxis p_axis) const;
 
+	// These only touch this body, so they can run for several bodies in parallel.
+	// Their changes to the broadphase and to the space lists are applied afterwards by the finish functions, serially.
 	void integrate_forces(real_t p_step);
+	void finish_integrate_forces();
 	void integrate_velocities(real_t p_step);
+	void finish_integrate_velocities();
 
 	_FORCE_INLINE_ Vector3 get_velocity_in_local_point(const Vector3 &rel_pos) const {
 		return linear_velocity + angular_velocity.cross(rel_pos - center_of_mass);
@@ -57,6 +57,7 @@ void GodotBodyPair3D::contact_added_callback(const Vector3 &p_point_A, int p_ind
 	contact.local_A = local_A;
 	contact.local_B = local_B;
 	contact.normal = (p_point_A - p_point_B).normalized();
+	contact.local_normal = A->get_inv_transform().basis.xform(contact.normal);
 	contact.used = true;
 
 	// Attempt to determine if the contact will be reused.
@@ -161,71 +162,37 @@ void GodotBodyPair3D::validate_contacts() {
 	}
 }
 
-// _test_ccd prevents tunneling by slowing down a high velocity body that is about to collide so that next frame it will be at an appropriate location to collide (i.e. slight overlap)
-// Warning: the way velocity is adjusted down to cause a collision means the momentum will be weaker than it should for a bounce!
-// Process: only proceed if body A's motion is high relative to its size.
-// cast forward along motion vector to see if A is going to enter/pass B's collider next frame, only proceed if it does.
-// adjust the velocity of A down so that it will just slightly intersect the collider instead of blowing right past it.
-bool GodotBodyPair3D::_test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B) {
-	Vector3 motion = p_A->get_linear_velocity() * p_step;
-	real_t mlen = motion.length();
-	if (mlen < CMP_EPSILON) {
-		return false;
-	}
-
-	Vector3 mnormal = motion / mlen;
+real_t combine_bounce(GodotBody3D *A, GodotBody3D *B) {
+	return CLAMP(A->get_bounce() + B->get_bounce(), 0, 1);
+}
 
-	real_t min = 0.0, max = 0.0;
-	p_A->get_shape(p_shape_A)->project_range(mnormal, p_xform_A, min, max);
+real_t combine_friction(GodotBody3D *A, GodotBody3D *B) {
+	return ABS(MIN(A->get_friction(), B->get_friction()));
+}
 
-	// Did it move enough in this direction to even attempt raycast?
-	// Let's say it should move more than 1/3 the size of the object in that axis.
-	bool fast_object = mlen > (max - min) * 0.3;
-	if (!fast_object) {
-		return false; // moving slow enough that there's no chance of tunneling.
+bool GodotBodyPair3D::_can_reuse_narrowphase(const Transform3D &p_relative_xform, const GodotShape3D *p_shape_B, real_t p_threshold) const {
+	if (!cache_valid || contact_count != cached_contact_count) {
+		// Contacts were dropped since the last narrowphase.
+		return false;
 	}
 
-	// A is moving fast enough that tunneling might occur. See if it's really about to collide.
-
-	// Cast a segment from support in motion normal, in the same direction of motion by motion length.
-	// Support point will the farthest forward collision point along the movement vector.
-	// i.e. the point that should hit B first if any collision does occur.
-
-	// convert mnormal into body A's local xform because get_support requires (and returns) local coordinates.
-	Vector3 s = p_A->get_shape(p_shape_A)->get_support(p_xform_A.basis.xform_inv(mnormal).normalized());
-	Vector3 from = p_xform_A.xform(s);
-	Vector3 to = from + motion;
-
-	Transform3D from_inv = p_xform_B.affine_inverse();
-
-	// Back up 10% of the per-frame motion behind the support point and use that as the beginning of our cast.
-	// At high speeds, this may mean we're actually casting from well behind the body instead of inside it, which is odd. But it still works out.
-	Vector3 local_from = from_inv.xform(from - motion * 0.1);
-	Vector3 local_to = from_inv.xform(to);
-
-	Vector3 rpos, rnorm;
-	if (!p_B->get_shape(p_shape_B)->intersect_segment(local_from, local_to, rpos, rnorm, true)) {
-		// there was no hit. Since the segment is the length of per-frame motion, this means the bodies will not
-		// actually collide yet on next frame. We'll probably check again next frame once they're closer.
+	if (A->get_shapes_version() != cached_shapes_version_A || B->get_shapes_version() != cached_shapes_version_B) {
 		return false;
 	}
 
-	// Shorten the linear velocity so it will collide next frame.
-	Vector3 hitpos = p_xform_B.xform(rpos);
+	// Upper bound of how far any point of shape B moved relative to shape A.
+	const AABB &aabb = p_shape_B->get_aabb();
+	Vector3 begin = aabb.position.abs();
+	Vector3 end = aabb.get_end().abs();
+	Vector3 extent(MAX(begin.x, end.x), MAX(begin.y, end.y), MAX(begin.z, end.z));
 
-	real_t newlen = hitpos.distance_to(from) + (max - min) * 0.01; // adding 1% of body length to the distance between collision and support point should cause body A's support point to arrive just within B's collider next frame.
-
-	p_A->set_linear_velocity((mnormal * newlen) / p_step);
+	real_t basis_change = 0.0;
+	for (int i = 0; i < 3; i++) {
+		basis_change += (p_relative_xform.basis.get_column(i) - cached_relative_xform.basis.get_column(i)).length_squared();
+	}
 
-	return true;
-}
-
-real_t combine_bounce(GodotBody3D *A, GodotBody3D *B) {
-	return CLAMP(A->get_bounce() + B->get_bounce(), 0, 1);
-}
-
-real_t combine_friction(GodotBody3D *A, GodotBody3D *B) {
-	return ABS(MIN(A->get_friction(), B->get_friction()));
+	real_t motion = (p_relative_xform.origin - cached_relative_xform.origin).length() + Math::sqrt(basis_change) * extent.length();
+	return motion < p_threshold;
 }
 
 bool GodotBodyPair3D::setup(real_t p_step) {
@@ -233,6 +200,7 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 
 	if (!A->interacts_with(B) || A->has_exception(B->get_self()) || B->has_exception(A->get_self())) {
 		collided = false;
+		cache_valid = false;
 		return false;
 	}
 
@@ -245,6 +213,7 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 			report_contacts_only = true;
 		} else {
 			collided = false;
+			cache_valid = false;
 			return false;
 		}
 	}
@@ -264,7 +233,33 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 	GodotShape3D *shape_A_ptr = A->get_shape(shape_A);
 	GodotShape3D *shape_B_ptr = B->get_shape(shape_B);
 
-	collided = GodotCollisionSolver3D::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
+	real_t cache_threshold = space->get_narrowphase_cache_threshold();
+	Transform3D relative_xform;
+	if (cache_threshold > 0.0) {
+		relative_xform = xform_A.affine_inverse() * xform_B;
+	}
+
+	if (cache_threshold > 0.0 && _can_reuse_narrowphase(relative_xform, shape_B_ptr, cache_threshold)) {
+		// Keep the contacts found by the last narrowphase. Both bodies may have moved together,
+		// so the normals follow the orientation of body A.
+		const Basis &basis_A = A->get_transform().basis;
+		for (int i = 0; i < contact_count; i++) {
+			contacts[i].normal = basis_A.xform(contacts[i].local_normal).normalized();
+			contacts[i].used = true;
+		}
+		collided = cached_collided;
+		space->add_narrowphase_cache_result(true);
+	} else {
+		collided = GodotCollisionSolver3D::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
+
+		cache_valid = cache_threshold > 0.0;
+		cached_relative_xform = relative_xform;
+		cached_shapes_version_A = A->get_shapes_version();
+		cached_shapes_version_B = B->get_shapes_version();
+		cached_contact_count = contact_count;
+		cached_collided = collided;
+		space->add_narrowphase_cache_result(false);
+	}
 
 	if (!collided) {
 		if (A->is_continuous_collision_detection_enabled() && collide_A) {
@@ -283,24 +278,55 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 	return true;
 }
 
-bool GodotBodyPair3D::pre_solve(real_t p_step) {
-	if (!collided) {
-		if (check_ccd) {
-			const Vector3 &offset_A = A->get_transform().get_origin();
-			Transform3D xform_Au = Transform3D(A->get_transform().basis, Vector3());
-			Transform3D xform_A = xform_Au * A->get_shape_transform(shape_A);
+// Sweeps the shapes along their linear motion for this step, scaled down for
+// bodies already stopped short by an earlier impact. Returns the fraction of
+// that motion at which they first overlap.
+bool GodotBodyPair3D::get_time_of_impact(real_t p_step, real_t &r_toi) const {
+	Vector3 motion = (A->get_linear_velocity() * A->get_ccd_motion_scale() - B->get_linear_velocity() * B->get_ccd_motion_scale()) * p_step;
+	real_t mlen = motion.length();
+	if (mlen < CMP_EPSILON) {
+		return false;
+	}
+
+	const Vector3 &offset_A = A->get_transform().get_origin();
+	Transform3D xform_Au = Transform3D(A->get_transform().basis, Vector3());
+	Transform3D xform_A = xform_Au * A->get_shape_transform(shape_A);
 
-			Transform3D xform_Bu = B->get_transform();
-			xform_Bu.origin -= offset_A;
-			Transform3D xform_B = xform_Bu * B->get_shape_transform(shape_B);
+	Transform3D xform_Bu = B->get_transform();
+	xform_Bu.origin -= offset_A;
+	Transform3D xform_B = xform_Bu * B->get_shape_transform(shape_B);
 
-			if (A->is_continuous_collision_detection_enabled() && collide_A) {
-				_test_ccd(p_step, A, shape_A, xform_A, B, shape_B, xform_B);
-			}
+	const GodotShape3D *shape_A_ptr = A->get_shape(shape_A);
+	const GodotShape3D *shape_B_ptr = B->get_shape(shape_B);
 
-			if (B->is_continuous_collision_detection_enabled() && collide_B) {
-				_test_ccd(p_step, B, shape_B, xform_B, A, shape_A, xform_A);
-			}
+	// Moving slow enough compared to the thinnest shape, the regular narrowphase can't miss the contact.
+	Vector3 mnormal = motion / mlen;
+	real_t min_A = 0.0, max_A = 0.0, min_B = 0.0, max_B = 0.0;
+	shape_A_ptr->project_range(mnormal, xform_A, min_A, max_A);
+	shape_B_ptr->project_range(mnormal, xform_B, min_B, max_B);
+	if (mlen < MIN(max_A - min_A, max_B - min_B) * 0.3) {
+		return false;
+	}
+
+	return GodotCollisionSolver3D::solve_time_of_impact(shape_A_ptr, xform_A, motion, shape_B_ptr, xform_B, space->get_contact_max_allowed_penetration(), r_toi);
+}
+
+void GodotBodyPair3D::apply_time_of_impact(real_t p_toi) {
+	// Only bodies integrated this step consume the scale, see GodotBody3D::integrate_velocities().
+	if (A->is_continuous_collision_detection_enabled() && collide_A && A->is_active() && A->get_mode() >= PhysicsServer3D::BODY_MODE_RIGID) {
+		A->set_ccd_motion_scale(A->get_ccd_motion_scale() * p_toi);
+	}
+
+	if (B->is_continuous_collision_detection_enabled() && collide_B && B->is_active() && B->get_mode() >= PhysicsServer3D::BODY_MODE_RIGID) {
+		B->set_ccd_motion_scale(B->get_ccd_motion_scale() * p_toi);
+	}
+}
+
+bool GodotBodyPair3D::pre_solve(real_t p_step) {
+	if (!collided) {
+		if (check_ccd) {
+			// Swept after the velocities are solved, see GodotStep3D.
+			space->add_ccd_pair(this);
 		}
 
 		return false;
@@ -385,10 +411,10 @@ bool GodotBodyPair3D::pre_solve(real_t p_step) {
 		do_process = true;
 
 		// Precompute normal mass, tangent mass, and bias.
-		Vector3 inertia_A = inv_inertia_tensor_A.xform(c.rA.cross(c.normal));
-		Vector3 inertia_B = inv_inertia_tensor_B.xform(c.rB.cross(c.normal));
+		c.inertia_A = inv_inertia_tensor_A.xform(c.rA.cross(c.normal));
+		c.inertia_B = inv_inertia_tensor_B.xform(c.rB.cross(c.normal));
 		real_t kNormal = inv_mass_A + inv_mass_B;
-		kNormal += c.normal.dot(inertia_A.cross(c.rA)) + c.normal.dot(inertia_B.cross(c.rB));
+		kNormal += c.normal.dot(c.inertia_A.cross(c.rA)) + c.normal.dot(c.inertia_B.cross(c.rB));
 		c.mass_normal = 1.0f / kNormal;
 
 		c.bias = -bias * inv_dt * MIN(0.0f, -depth + max_penetration);
@@ -429,6 +455,9 @@ void GodotBodyPair3D::solve(real_t p_step) {
 
 	real_t inv_mass_A = collide_A ? A->get_inv_mass() : 0.0;
 	real_t inv_mass_B = collide_B ? B->get_inv_mass() : 0.0;
+	const real_t mass_com = 1.0 / (inv_mass_A + inv_mass_B);
+
+	const real_t friction = combine_friction(A, B);
 
 	for (int i = 0; i < contact_count; i++) {
 		Contact &c = contacts[i];
@@ -451,13 +480,15 @@ void GodotBodyPair3D::solve(real_t p_step) {
 			real_t jbnOld = c.acc_bias_impulse;
 			c.acc_bias_impulse = MAX(jbnOld + jbn, 0.0f);
 
-			Vector3 jb = c.normal * (c.acc_bias_impulse - jbnOld);
+			// Impulses are along the normal, so the angular velocity change is precomputed.
+			real_t jb_len = c.acc_bias_impulse - jbnOld;
+			Vector3 jb = c.normal * jb_len;
 
 			if (collide_A) {
-				A->apply_bias_impulse(-jb, c.rA + A->get_center_of_mass(), max_bias_av);
+				A->apply_precomputed_bias_impulse(-jb, c.inertia_A * -jb_len, max_bias_av);
 			}
 			if (collide_B) {
-				B->apply_bias_impulse(jb, c.rB + B->get_center_of_mass(), max_bias_av);
+				B->apply_precomputed_bias_impulse(jb, c.inertia_B * jb_len, max_bias_av);
 			}
 
 			crbA = A->get_biased_angular_velocity().cross(c.rA);
@@ -467,7 +498,7 @@ void GodotBodyPair3D::solve(real_t p_step) {
 			vbn = dbv.dot(c.normal);
 
 			if (Math::abs(-vbn + c.bias) > MIN_VELOCITY) {
-				real_t jbn_com = (-vbn + c.bias) / (inv_mass_A + inv_mass_B);
+				real_t jbn_com = (-vbn + c.bias) * mass_com;
 				real_t jbnOld_com = c.acc_bias_impulse_center_of_mass;
 				c.acc_bias_impulse_center_of_mass = MAX(jbnOld_com + jbn_com, 0.0f);
 
@@ -496,13 +527,14 @@ void GodotBodyPair3D::solve(real_t p_step) {
 			real_t jnOld = c.acc_normal_impulse;
 			c.acc_normal_impulse = MAX(jnOld + jn, 0.0f);
 
-			Vector3 j = c.normal * (c.acc_normal_impulse - jnOld);
+			real_t j_len = c.acc_normal_impulse - jnOld;
+			Vector3 j = c.normal * j_len;
 
 			if (collide_A) {
-				A->apply_impulse(-j, c.rA + A->get_center_of_mass());
+				A->apply_precomputed_impulse(-j, c.inertia_A * -j_len);
 			}
 			if (collide_B) {
-				B->apply_impulse(j, c.rB + B->get_center_of_mass());
+				B->apply_precomputed_impulse(j, c.inertia_B * j_len);
 			}
 
 			c.active = true;
@@ -510,8 +542,6 @@ void GodotBodyPair3D::solve(real_t p_step) {
 
 		//friction impulse
 
-		real_t friction = combine_friction(A, B);
-
 		Vector3 lvA = A->get_linear_velocity() + A->get_angular_velocity().cross(c.rA);
 		Vector3 lvB = B->get_linear_velocity() + B->get_angular_velocity().cross(c.rB);
 
@@ -42,6 +42,7 @@ protected:
 	struct Contact {
 		Vector3 position;
 		Vector3 normal;
+		Vector3 local_normal; // Normal in the orientation of body A, to follow it when the narrowphase is skipped.
 		int index_A = 0, index_B = 0;
 		Vector3 local_A, local_B;
 		real_t acc_normal_impulse = 0.0; // accumulated normal impulse (Pn)
@@ -56,6 +57,7 @@ protected:
 		bool active = false;
 		bool used = false;
 		Vector3 rA, rB; // Offset in world orientation with respect to center of mass
+		Vector3 inertia_A, inertia_B; // Angular velocity change for a unit impulse along the normal.
 	};
 
 	Vector3 sep_axis;
@@ -96,18 +98,29 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	Contact contacts[MAX_CONTACTS];
 	int contact_count = 0;
 
+	// Result of the last narrowphase, reused while shape B barely moves relative to shape A.
+	Transform3D cached_relative_xform;
+	uint64_t cached_shapes_version_A = 0;
+	uint64_t cached_shapes_version_B = 0;
+	int cached_contact_count = 0;
+	bool cached_collided = false;
+	bool cache_valid = false;
+
 	static void _contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, void *p_userdata);
 
 	void contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B);
 
 	void validate_contacts();
-	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
+	bool _can_reuse_narrowphase(const Transform3D &p_relative_xform, const GodotShape3D *p_shape_B, real_t p_threshold) const;
 
 public:
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	bool get_time_of_impact(real_t p_step, real_t &r_toi) const;
+	void apply_time_of_impact(real_t p_toi);
+
 	GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p_B, int p_shape_B);
 	~GodotBodyPair3D();
 };
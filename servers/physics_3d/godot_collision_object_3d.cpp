@@ -52,6 +52,7 @@ void GodotCollisionObject3D::set_shape(int p_index, GodotShape3D *p_shape) {
 	ERR_FAIL_INDEX(p_index, shapes.size());
 	shapes[p_index].shape->remove_owner(this);
 	shapes.write[p_index].shape = p_shape;
+	shapes_version++;
 
 	p_shape->add_owner(this);
 	if (!pending_shape_update_list.in_list()) {
@@ -138,6 +139,27 @@ void GodotCollisionObject3D::_set_static(bool p_static) {
 		const Shape &s = shapes[i];
 		if (s.bpid > 0) {
 			space->get_broadphase()->set_static(s.bpid, _static);
+			if (_sleeping) {
+				space->get_broadphase()->set_sleeping(s.bpid, true);
+			}
+		}
+	}
+}
+
+void GodotCollisionObject3D::_set_sleeping(bool p_sleeping) {
+	if (_sleeping == p_sleeping) {
+		return;
+	}
+	_sleeping = p_sleeping;
+
+	if (!space) {
+		return;
+	}
+	space->add_sleeping_objects(_sleeping ? 1 : -1);
+	for (int i = 0; i < get_shape_count(); i++) {
+		const Shape &s = shapes[i];
+		if (s.bpid > 0) {
+			space->get_broadphase()->set_sleeping(s.bpid, _sleeping);
 		}
 	}
 }
@@ -176,6 +198,9 @@ void GodotCollisionObject3D::_update_shapes() {
 		if (s.bpid == 0) {
 			s.bpid = space->get_broadphase()->create(this, i, shape_aabb, _static);
 			space->get_broadphase()->set_static(s.bpid, _static);
+			if (_sleeping) {
+				space->get_broadphase()->set_sleeping(s.bpid, true);
+			}
 		}
 
 		space->get_broadphase()->move(s.bpid, shape_aabb);
@@ -203,6 +228,9 @@ void GodotCollisionObject3D::_update_shapes_with_motion(const Vector3 &p_motion)
 		if (s.bpid == 0) {
 			s.bpid = space->get_broadphase()->create(this, i, shape_aabb, _static);
 			space->get_broadphase()->set_static(s.bpid, _static);
+			if (_sleeping) {
+				space->get_broadphase()->set_sleeping(s.bpid, true);
+			}
 		}
 
 		space->get_broadphase()->move(s.bpid, shape_aabb);
@@ -211,6 +239,9 @@ void GodotCollisionObject3D::_update_shapes_with_motion(const Vector3 &p_motion)
 
 void GodotCollisionObject3D::_set_space(GodotSpace3D *p_space) {
 	if (space) {
+		if (_sleeping) {
+			space->add_sleeping_objects(-1);
+		}
 		space->remove_object(this);
 
 		for (int i = 0; i < shapes.size(); i++) {
@@ -226,11 +257,15 @@ void GodotCollisionObject3D::_set_space(GodotSpace3D *p_space) {
 
 	if (space) {
 		space->add_object(this);
+		if (_sleeping) {
+			space->add_sleeping_objects(1);
+		}
 		_update_shapes();
 	}
 }
 
 void GodotCollisionObject3D::_shape_changed() {
+	shapes_version++;
 	_update_shapes();
 	_shapes_changed();
 }
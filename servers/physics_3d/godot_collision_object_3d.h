@@ -72,16 +72,17 @@ private:
 	};
 
 	Vector<Shape> shapes;
+	uint64_t shapes_version = 0; // Incremented when a shape is replaced or its data changes.
 	GodotSpace3D *space = nullptr;
 	Transform3D transform;
 	Transform3D inv_transform;
 	bool _static = true;
+	bool _sleeping = false;
 
 	SelfList<GodotCollisionObject3D> pending_shape_update_list;
 
-	void _update_shapes();
-
 protected:
+	void _update_shapes();
 	void _update_shapes_with_motion(const Vector3 &p_motion);
 	void _unregister_shapes();
 
@@ -98,6 +99,7 @@ protected:
 	}
 	_FORCE_INLINE_ void _set_inv_transform(const Transform3D &p_transform) { inv_transform = p_transform; }
 	void _set_static(bool p_static);
+	void _set_sleeping(bool p_sleeping);
 
 	virtual void _shapes_changed() = 0;
 	void _set_space(GodotSpace3D *p_space);
@@ -141,6 +143,8 @@ public:
 		return shapes[p_index].area_cache;
 	}
 
+	_FORCE_INLINE_ uint64_t get_shapes_version() const { return shapes_version; }
+
 	_FORCE_INLINE_ const Transform3D &get_transform() const { return transform; }
 	_FORCE_INLINE_ const Transform3D &get_inv_transform() const { return inv_transform; }
 	_FORCE_INLINE_ GodotSpace3D *get_space() const { return space; }
@@ -187,6 +191,7 @@ public:
 	virtual void set_space(GodotSpace3D *p_space) = 0;
 
 	_FORCE_INLINE_ bool is_static() const { return _static; }
+	_FORCE_INLINE_ bool is_sleeping() const { return _sleeping; }
 
 	virtual ~GodotCollisionObject3D() {}
 };
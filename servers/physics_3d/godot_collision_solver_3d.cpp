@@ -587,3 +587,116 @@ bool GodotCollisionSolver3D::solve_distance(const GodotShape3D *p_shape_A, const
 		return gjk_epa_calculate_distance(p_shape_A, p_transform_A, p_shape_B, p_transform_B, r_point_A, r_point_B); //should pass sepaxis..
 	}
 }
+
+// Conservative advancement: the closest points give a separating plane, and the
+// shape can't reach it before travelling the distance along the plane normal.
+// Stepping by that amount never skips past the first contact, and converges
+// quickly towards it.
+bool GodotCollisionSolver3D::solve_time_of_impact_convex(const GodotShape3D *p_shape_A, const Transform3D &p_transform_A, const Vector3 &p_motion, const GodotShape3D *p_shape_B, const Transform3D &p_transform_B, real_t p_penetration, real_t &r_toi) {
+	static const int max_iterations = 16;
+	static const real_t tolerance = 0.001;
+
+	real_t toi = 0.0;
+	for (int i = 0; i < max_iterations; i++) {
+		Transform3D xform_A = p_transform_A;
+		xform_A.origin += p_motion * toi;
+
+		Vector3 close_A, close_B;
+		if (!solve_distance(p_shape_A, xform_A, p_shape_B, p_transform_B, close_A, close_B, AABB())) {
+			if (i == 0) {
+				// Already overlapping, the regular narrowphase takes care of it.
+				return false;
+			}
+			break;
+		}
+
+		Vector3 normal = close_B - close_A;
+		real_t distance = normal.length();
+		if (distance < CMP_EPSILON) {
+			break;
+		}
+		normal /= distance;
+
+		real_t closing = p_motion.dot(normal);
+		if (closing <= CMP_EPSILON) {
+			// Moving apart or sliding along, no impact.
+			return false;
+		}
+
+		if (distance < tolerance) {
+			// Push slightly into the other shape, so the next narrowphase finds the contact.
+			toi += (distance + p_penetration) / closing;
+			break;
+		}
+
+		toi += distance / closing;
+		if (toi > 1.0) {
+			return false;
+		}
+	}
+
+	r_toi = MIN(toi, (real_t)1.0);
+	return true;
+}
+
+struct _ConcaveTimeOfImpactInfo {
+	const GodotShape3D *shape_A = nullptr;
+	const Transform3D *transform_A = nullptr;
+	Vector3 motion;
+	const Transform3D *transform_B = nullptr;
+	real_t penetration = 0.0;
+	real_t toi = 1.0;
+	bool hit = false;
+};
+
+bool GodotCollisionSolver3D::concave_time_of_impact_callback(void *p_userdata, GodotShape3D *p_convex) {
+	_ConcaveTimeOfImpactInfo &info = *(static_cast<_ConcaveTimeOfImpactInfo *>(p_userdata));
+
+	real_t toi = 1.0;
+	if (solve_time_of_impact_convex(info.shape_A, *info.transform_A, info.motion, p_convex, *info.transform_B, info.penetration, toi) && toi <= info.toi) {
+		info.toi = toi;
+		info.hit = true;
+	}
+
+	return false;
+}
+
+bool GodotCollisionSolver3D::solve_time_of_impact(const GodotShape3D *p_shape_A, const Transform3D &p_transform_A, const Vector3 &p_motion, const GodotShape3D *p_shape_B, const Transform3D &p_transform_B, real_t p_penetration, real_t &r_toi) {
+	if (p_motion.length_squared() < CMP_EPSILON2) {
+		return false;
+	}
+
+	if (p_shape_A->is_concave() || p_shape_A->get_type() == PhysicsServer3D::SHAPE_WORLD_BOUNDARY) {
+		if (p_shape_B->is_concave() || p_shape_B->get_type() == PhysicsServer3D::SHAPE_WORLD_BOUNDARY) {
+			return false;
+		}
+		// Only convex shapes can be swept, the relative motion is the same from the other side.
+		return solve_time_of_impact(p_shape_B, p_transform_B, -p_motion, p_shape_A, p_transform_A, p_penetration, r_toi);
+	}
+
+	if (!p_shape_B->is_concave()) {
+		return solve_time_of_impact_convex(p_shape_A, p_transform_A, p_motion, p_shape_B, p_transform_B, p_penetration, r_toi);
+	}
+
+	const GodotConcaveShape3D *concave_B = static_cast<const GodotConcaveShape3D *>(p_shape_B);
+
+	// Only faces touched by the swept shape can be hit.
+	AABB swept_aabb = p_transform_A.xform(p_shape_A->get_aabb());
+	swept_aabb = swept_aabb.merge(AABB(swept_aabb.position + p_motion, swept_aabb.size));
+	swept_aabb = swept_aabb.grow(p_penetration);
+
+	_ConcaveTimeOfImpactInfo info;
+	info.shape_A = p_shape_A;
+	info.transform_A = &p_transform_A;
+	info.motion = p_motion;
+	info.transform_B = &p_transform_B;
+	info.penetration = p_penetration;
+
+	concave_B->cull(p_transform_B.affine_inverse().xform(swept_aabb), concave_time_of_impact_callback, &info, false);
+
+	if (info.hit) {
+		r_toi = info.toi;
+	}
+
+	return info.hit;
+}
@@ -437,6 +437,42 @@ void GodotPhysicsServer3D::area_set_area_monitor_callback(RID p_area, const Call
 	area->set_area_monitor_callback(p_callback.is_valid() ? p_callback : Callable());
 }
 
+void GodotPhysicsServer3D::area_set_monitor_batch_callback(RID p_area, const Callable &p_callback) {
+	GodotArea3D *area = area_owner.get_or_null(p_area);
+	ERR_FAIL_COND(!area);
+
+	area->set_monitor_batch_callback(p_callback.is_valid() ? p_callback : Callable());
+}
+
+void GodotPhysicsServer3D::area_set_area_monitor_batch_callback(RID p_area, const Callable &p_callback) {
+	GodotArea3D *area = area_owner.get_or_null(p_area);
+	ERR_FAIL_COND(!area);
+
+	area->set_area_monitor_batch_callback(p_callback.is_valid() ? p_callback : Callable());
+}
+
+Vector<RID> GodotPhysicsServer3D::area_get_overlapping_bodies(RID p_area) const {
+	GodotArea3D *area = area_owner.get_or_null(p_area);
+	ERR_FAIL_COND_V(!area, Vector<RID>());
+
+	Vector<RID> ret;
+	for (const KeyValue<RID, int> &E : area->get_overlapping_bodies()) {
+		ret.push_back(E.key);
+	}
+	return ret;
+}
+
+Vector<RID> GodotPhysicsServer3D::area_get_overlapping_areas(RID p_area) const {
+	GodotArea3D *area = area_owner.get_or_null(p_area);
+	ERR_FAIL_COND_V(!area, Vector<RID>());
+
+	Vector<RID> ret;
+	for (const KeyValue<RID, int> &E : area->get_overlapping_areas()) {
+		ret.push_back(E.key);
+	}
+	return ret;
+}
+
 /* BODY API */
 
 RID GodotPhysicsServer3D::body_create() {
@@ -691,6 +727,32 @@ Variant GodotPhysicsServer3D::body_get_state(RID p_body, BodyState p_state) cons
 	return body->get_state(p_state);
 }
 
+void GodotPhysicsServer3D::body_set_states(const Vector<RID> &p_bodies, BodyState p_state, const Vector<Variant> &p_values) {
+	ERR_FAIL_COND(p_bodies.size() != p_values.size());
+	const RID *bodies = p_bodies.ptr();
+	const Variant *values = p_values.ptr();
+	for (int i = 0; i < p_bodies.size(); i++) {
+		GodotBody3D *body = body_owner.get_or_null(bodies[i]);
+		ERR_CONTINUE(!body);
+
+		body->set_state(p_state, values[i]);
+	}
+}
+
+Vector<Variant> GodotPhysicsServer3D::body_get_states(const Vector<RID> &p_bodies, BodyState p_state) const {
+	Vector<Variant> ret;
+	ret.resize(p_bodies.size());
+	const RID *bodies = p_bodies.ptr();
+	Variant *w = ret.ptrw();
+	for (int i = 0; i < p_bodies.size(); i++) {
+		GodotBody3D *body = body_owner.get_or_null(bodies[i]);
+		ERR_CONTINUE(!body);
+
+		w[i] = body->get_state(p_state);
+	}
+	return ret;
+}
+
 void GodotPhysicsServer3D::body_apply_central_impulse(RID p_body, const Vector3 &p_impulse) {
 	GodotBody3D *body = body_owner.get_or_null(p_body);
 	ERR_FAIL_COND(!body);
@@ -1640,11 +1702,17 @@ void GodotPhysicsServer3D::step(real_t p_step) {
 	island_count = 0;
 	active_objects = 0;
 	collision_pairs = 0;
+	narrowphase_cache_hits = 0;
+	narrowphase_cache_misses = 0;
+	sleeping_objects = 0;
 	for (const GodotSpace3D *E : active_spaces) {
 		stepper->step(const_cast<GodotSpace3D *>(E), p_step);
 		island_count += E->get_island_count();
 		active_objects += E->get_active_objects();
 		collision_pairs += E->get_collision_pairs();
+		narrowphase_cache_hits += E->get_narrowphase_cache_hits();
+		narrowphase_cache_misses += E->get_narrowphase_cache_misses();
+		sleeping_objects += E->get_sleeping_objects();
 	}
 #endif
 }
@@ -1725,6 +1793,15 @@ int GodotPhysicsServer3D::get_process_info(ProcessInfo p_info) {
 		case INFO_ISLAND_COUNT: {
 			return island_count;
 		} break;
+		case INFO_NARROWPHASE_CACHE_HITS: {
+			return narrowphase_cache_hits;
+		} break;
+		case INFO_NARROWPHASE_CACHE_MISSES: {
+			return narrowphase_cache_misses;
+		} break;
+		case INFO_SLEEPING_OBJECTS: {
+			return sleeping_objects;
+		} break;
 	}
 
 	return 0;
@@ -48,6 +48,9 @@ class GodotPhysicsServer3D : public PhysicsServer3D {
 	int island_count = 0;
 	int active_objects = 0;
 	int collision_pairs = 0;
+	int narrowphase_cache_hits = 0;
+	int narrowphase_cache_misses = 0;
+	int sleeping_objects = 0;
 
 	bool using_threads = false;
 	bool doing_sync = false;
@@ -158,6 +161,11 @@ public:
 
 	virtual void area_set_monitor_callback(RID p_area, const Callable &p_callback) override;
 	virtual void area_set_area_monitor_callback(RID p_area, const Callable &p_callback) override;
+	virtual void area_set_monitor_batch_callback(RID p_area, const Callable &p_callback) override;
+	virtual void area_set_area_monitor_batch_callback(RID p_area, const Callable &p_callback) override;
+
+	virtual Vector<RID> area_get_overlapping_bodies(RID p_area) const override;
+	virtual Vector<RID> area_get_overlapping_areas(RID p_area) const override;
 
 	/* BODY API */
 
@@ -208,6 +216,8 @@ public:
 
 	virtual void body_set_state(RID p_body, BodyState p_state, const Variant &p_variant) override;
 	virtual Variant body_get_state(RID p_body, BodyState p_state) const override;
+	virtual void body_set_states(const Vector<RID> &p_bodies, BodyState p_state, const Vector<Variant> &p_values) override;
+	virtual Vector<Variant> body_get_states(const Vector<RID> &p_bodies, BodyState p_state) const override;
 
 	virtual void body_apply_central_impulse(RID p_body, const Vector3 &p_impulse) override;
 	virtual void body_apply_impulse(RID p_body, const Vector3 &p_impulse, const Vector3 &p_position = Vector3()) override;
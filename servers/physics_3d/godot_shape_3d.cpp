@@ -33,6 +33,7 @@
 #include "core/io/image.h"
 #include "core/math/convex_hull.h"
 #include "core/math/geometry_3d.h"
+#include "core/templates/hash_map.h"
 #include "core/templates/sort_array.h"
 
 // GodotHeightMapShape3D is based on Bullet btHeightfieldTerrainShape.
@@ -1328,14 +1329,39 @@ Vector3 GodotConcavePolygonShape3D::get_support(const Vector3 &p_normal) const {
 	return vptr[vert_support_idx];
 }
 
-void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_params) const {
-	const BVH *params_bvh = &p_params->bvh[p_idx];
+void GodotConcavePolygonShape3D::_quantize_aabb(const AABB &p_aabb, uint16_t *r_min, uint16_t *r_max) const {
+	Vector3 begin = (p_aabb.position - bvh_origin) * bvh_scale;
+	Vector3 end = (p_aabb.position + p_aabb.size - bvh_origin) * bvh_scale;
 
-	if (!params_bvh->aabb.intersects_segment(p_params->from, p_params->to)) {
-		return;
+	for (int i = 0; i < 3; i++) {
+		// Rounded outwards with an extra step, so the bounds stay conservative once dequantized.
+		r_min[i] = (uint16_t)CLAMP(Math::floor(begin[i]) - 1, (real_t)0, (real_t)UINT16_MAX);
+		r_max[i] = (uint16_t)CLAMP(Math::ceil(end[i]) + 1, (real_t)0, (real_t)UINT16_MAX);
 	}
+}
+
+AABB GodotConcavePolygonShape3D::_get_bvh_aabb(const BVH &p_node) const {
+	Vector3 begin(p_node.min[0], p_node.min[1], p_node.min[2]);
+	Vector3 end(p_node.max[0], p_node.max[1], p_node.max[2]);
+	return AABB(bvh_origin + begin * bvh_inv_scale, (end - begin) * bvh_inv_scale);
+}
+
+void GodotConcavePolygonShape3D::_cull_segment(_SegmentCullParams *p_params) const {
+	int idx = 0;
+	while (idx < p_params->bvh_count) {
+		const BVH *params_bvh = &p_params->bvh[idx];
+
+		if (!_get_bvh_aabb(*params_bvh).intersects_segment(p_params->from, p_params->to)) {
+			// Skip the whole subtree.
+			idx = (params_bvh->face_index >= 0) ? idx + 1 : -params_bvh->face_index;
+			continue;
+		}
+
+		idx++;
+		if (params_bvh->face_index < 0) {
+			continue;
+		}
 
-	if (params_bvh->face_index >= 0) {
 		const Face *f = &p_params->faces[params_bvh->face_index];
 		GodotFaceShape3D *face = p_params->face;
 		face->normal = f->normal;
@@ -1354,13 +1380,6 @@ void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_
 				p_params->collisions++;
 			}
 		}
-	} else {
-		if (params_bvh->left >= 0) {
-			_cull_segment(params_bvh->left, p_params);
-		}
-		if (params_bvh->right >= 0) {
-			_cull_segment(params_bvh->right, p_params);
-		}
 	}
 }
 
@@ -1385,11 +1404,12 @@ bool GodotConcavePolygonShape3D::intersect_segment(const Vector3 &p_begin, const
 	params.faces = fr;
 	params.vertices = vr;
 	params.bvh = br;
+	params.bvh_count = bvh.size();
 
 	params.face = &face;
 
 	// cull
-	_cull_segment(0, &params);
+	_cull_segment(&params);
 
 	if (params.collisions > 0) {
 		r_result = params.result;
@@ -1408,14 +1428,28 @@ Vector3 GodotConcavePolygonShape3D::get_closest_point_to(const Vector3 &p_point)
 	return Vector3();
 }
 
-bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
-	const BVH *params_bvh = &p_params->bvh[p_idx];
+bool GodotConcavePolygonShape3D::_cull(_CullParams *p_params) const {
+	const uint16_t *aabb_min = p_params->aabb_min;
+	const uint16_t *aabb_max = p_params->aabb_max;
 
-	if (!p_params->aabb.intersects(params_bvh->aabb)) {
-		return false;
-	}
+	int idx = 0;
+	while (idx < p_params->bvh_count) {
+		const BVH *params_bvh = &p_params->bvh[idx];
+
+		// Both bounds are quantized the same way, so they can be compared directly.
+		if (params_bvh->min[0] > aabb_max[0] || params_bvh->max[0] < aabb_min[0] ||
+				params_bvh->min[1] > aabb_max[1] || params_bvh->max[1] < aabb_min[1] ||
+				params_bvh->min[2] > aabb_max[2] || params_bvh->max[2] < aabb_min[2]) {
+			// Skip the whole subtree.
+			idx = (params_bvh->face_index >= 0) ? idx + 1 : -params_bvh->face_index;
+			continue;
+		}
+
+		idx++;
+		if (params_bvh->face_index < 0) {
+			continue;
+		}
 
-	if (params_bvh->face_index >= 0) {
 		const Face *f = &p_params->faces[params_bvh->face_index];
 		GodotFaceShape3D *face = p_params->face;
 		face->normal = f->normal;
@@ -1425,18 +1459,6 @@ bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
 		if (p_params->callback(p_params->userdata, face)) {
 			return true;
 		}
-	} else {
-		if (params_bvh->left >= 0) {
-			if (_cull(params_bvh->left, p_params)) {
-				return true;
-			}
-		}
-
-		if (params_bvh->right >= 0) {
-			if (_cull(params_bvh->right, p_params)) {
-				return true;
-			}
-		}
 	}
 
 	return false;
@@ -1448,7 +1470,9 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 		return;
 	}
 
-	AABB local_aabb = p_local_aabb;
+	if (!p_local_aabb.intersects(get_aabb())) {
+		return;
+	}
 
 	// unlock data
 	const Face *fr = faces.ptr();
@@ -1460,16 +1484,17 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 	face.invert_backface_collision = p_invert_backface_collision;
 
 	_CullParams params;
-	params.aabb = local_aabb;
+	_quantize_aabb(p_local_aabb, params.aabb_min, params.aabb_max);
 	params.face = &face;
 	params.faces = fr;
 	params.vertices = vr;
 	params.bvh = br;
+	params.bvh_count = bvh.size();
 	params.callback = p_callback;
 	params.userdata = p_userdata;
 
 	// cull
-	_cull(0, &params);
+	_cull(&params);
 }
 
 Vector3 GodotConcavePolygonShape3D::get_moment_of_inertia(real_t p_mass) const {
@@ -1564,26 +1589,16 @@ _Volume_BVH *_volume_build_bvh(_Volume_BVH_Element *p_elements, int p_size, int
 }
 
 void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) {
-	int idx = p_idx;
-
-	p_bvh_array[idx].aabb = p_bvh_tree->aabb;
-	p_bvh_array[idx].face_index = p_bvh_tree->face_index;
-	//printf("%p - %i: %i(%p)  -- %p:%p\n",%p_bvh_array[idx],p_idx,p_bvh_array[i]->face_index,&p_bvh_tree->face_index,p_bvh_tree->left,p_bvh_tree->right);
-
-	if (p_bvh_tree->left) {
-		p_bvh_array[idx].left = ++p_idx;
-		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
+	BVH &node = p_bvh_array[p_idx++];
+	_quantize_aabb(p_bvh_tree->aabb, node.min, node.max);
 
+	if (p_bvh_tree->face_index >= 0) {
+		node.face_index = p_bvh_tree->face_index;
 	} else {
-		p_bvh_array[p_idx].left = -1;
-	}
-
-	if (p_bvh_tree->right) {
-		p_bvh_array[idx].right = ++p_idx;
+		// Non-leaf nodes always have both children.
+		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
 		_fill_bvh(p_bvh_tree->right, p_bvh_array, p_idx);
-
-	} else {
-		p_bvh_array[p_idx].right = -1;
+		node.face_index = -p_idx;
 	}
 
 	memdelete(p_bvh_tree);
@@ -1608,9 +1623,9 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 	faces.resize(src_face_count);
 	Face *facesw = faces.ptrw();
 
-	vertices.resize(src_face_count * 3);
-
-	Vector3 *verticesw = vertices.ptrw();
+	// Meshes usually share most of their vertices between faces.
+	HashMap<Vector3, int> vertex_indices;
+	LocalVector<Vector3> unique_vertices;
 
 	AABB _aabb;
 
@@ -1620,13 +1635,17 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 		bvh_arrayw[i].aabb = face.get_aabb();
 		bvh_arrayw[i].center = bvh_arrayw[i].aabb.get_center();
 		bvh_arrayw[i].face_index = i;
-		facesw[i].indices[0] = i * 3 + 0;
-		facesw[i].indices[1] = i * 3 + 1;
-		facesw[i].indices[2] = i * 3 + 2;
+		for (int j = 0; j < 3; j++) {
+			HashMap<Vector3, int>::Iterator E = vertex_indices.find(face.vertex[j]);
+			if (E) {
+				facesw[i].indices[j] = E->value;
+			} else {
+				facesw[i].indices[j] = unique_vertices.size();
+				vertex_indices.insert(face.vertex[j], unique_vertices.size());
+				unique_vertices.push_back(face.vertex[j]);
+			}
+		}
 		facesw[i].normal = face.get_plane().normal;
-		verticesw[i * 3 + 0] = face.vertex[0];
-		verticesw[i * 3 + 1] = face.vertex[1];
-		verticesw[i * 3 + 2] = face.vertex[2];
 		if (i == 0) {
 			_aabb = bvh_arrayw[i].aabb;
 		} else {
@@ -1634,10 +1653,22 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 		}
 	}
 
+	vertices.resize(unique_vertices.size());
+	Vector3 *verticesw = vertices.ptrw();
+	for (uint32_t i = 0; i < unique_vertices.size(); i++) {
+		verticesw[i] = unique_vertices[i];
+	}
+
+	// The quantization bounds are a bit larger than the shape, so flat meshes don't have a zero extent.
+	AABB quantization_aabb = _aabb.grow(MAX(_aabb.get_longest_axis_size() * 0.001, 0.001));
+	bvh_origin = quantization_aabb.position;
+	bvh_scale = Vector3(UINT16_MAX, UINT16_MAX, UINT16_MAX) / quantization_aabb.size;
+	bvh_inv_scale = quantization_aabb.size / UINT16_MAX;
+
 	int count = 0;
 	_Volume_BVH *bvh_tree = _volume_build_bvh(bvh_arrayw, src_face_count, count);
 
-	bvh.resize(count + 1);
+	bvh.resize(count);
 
 	BVH *bvh_arrayw2 = bvh.ptrw();
 
@@ -2003,6 +2034,98 @@ void GodotHeightMapShape3D::_get_cell(const Vector3 &p_point, int &r_x, int &r_y
 	r_z = (clamped_point.z < 0.0) ? (clamped_point.z - 0.5) : (clamped_point.z + 0.5);
 }
 
+struct _HeightmapCullParams {
+	// Range of cells to test, end excluded.
+	int start_x = 0;
+	int end_x = 0;
+	int start_z = 0;
+	int end_z = 0;
+
+	real_t min_y = 0.0;
+	real_t max_y = 0.0;
+
+	GodotConcaveShape3D::QueryCallback callback = nullptr;
+	void *userdata = nullptr;
+
+	const GodotHeightMapShape3D *heightmap = nullptr;
+	GodotFaceShape3D *face = nullptr;
+};
+
+static bool _heightmap_cull_cells(const _HeightmapCullParams &p_params, int p_start_x, int p_end_x, int p_start_z, int p_end_z) {
+	const GodotHeightMapShape3D *heightmap = p_params.heightmap;
+	GodotFaceShape3D *face = p_params.face;
+
+	for (int z = p_start_z; z < p_end_z; z++) {
+		for (int x = p_start_x; x < p_end_x; x++) {
+			real_t h00 = heightmap->_get_height(x, z);
+			real_t h10 = heightmap->_get_height(x + 1, z);
+			real_t h01 = heightmap->_get_height(x, z + 1);
+			real_t h11 = heightmap->_get_height(x + 1, z + 1);
+			if (MAX(MAX(h00, h10), MAX(h01, h11)) < p_params.min_y || MIN(MIN(h00, h10), MIN(h01, h11)) > p_params.max_y) {
+				continue;
+			}
+
+			// First triangle.
+			heightmap->_get_point(x, z, face->vertex[0]);
+			heightmap->_get_point(x + 1, z, face->vertex[1]);
+			heightmap->_get_point(x, z + 1, face->vertex[2]);
+			face->normal = Plane(face->vertex[0], face->vertex[1], face->vertex[2]).normal;
+			if (p_params.callback(p_params.userdata, face)) {
+				return true;
+			}
+
+			// Second triangle.
+			face->vertex[0] = face->vertex[1];
+			heightmap->_get_point(x + 1, z + 1, face->vertex[1]);
+			face->normal = Plane(face->vertex[0], face->vertex[1], face->vertex[2]).normal;
+			if (p_params.callback(p_params.userdata, face)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+// Level 0 is the bounds grid, higher levels are taken from the bounds mips.
+static bool _heightmap_cull_bounds(const _HeightmapCullParams &p_params, int p_level, int p_x, int p_z) {
+	const GodotHeightMapShape3D *heightmap = p_params.heightmap;
+
+	const GodotHeightMapShape3D::Range &range = (p_level == 0) ? heightmap->_get_bounds_chunk(p_x, p_z) : heightmap->bounds_mips[p_level - 1].ranges[p_z * heightmap->bounds_mips[p_level - 1].width + p_x];
+	if (range.max < p_params.min_y || range.min > p_params.max_y) {
+		return false;
+	}
+
+	if (p_level == 0) {
+		int start_x = MAX(p_x * GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE, p_params.start_x);
+		int end_x = MIN((p_x + 1) * GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE, p_params.end_x);
+		int start_z = MAX(p_z * GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE, p_params.start_z);
+		int end_z = MIN((p_z + 1) * GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE, p_params.end_z);
+		return _heightmap_cull_cells(p_params, start_x, end_x, start_z, end_z);
+	}
+
+	int child_level = p_level - 1;
+	int child_size = GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE << child_level;
+	int child_width = (child_level == 0) ? heightmap->bounds_grid_width : heightmap->bounds_mips[child_level - 1].width;
+	int child_depth = (child_level == 0) ? heightmap->bounds_grid_depth : heightmap->bounds_mips[child_level - 1].depth;
+
+	for (int z = p_z * 2; z < MIN(p_z * 2 + 2, child_depth); z++) {
+		if (z * child_size >= p_params.end_z || (z + 1) * child_size <= p_params.start_z) {
+			continue;
+		}
+		for (int x = p_x * 2; x < MIN(p_x * 2 + 2, child_width); x++) {
+			if (x * child_size >= p_params.end_x || (x + 1) * child_size <= p_params.start_x) {
+				continue;
+			}
+			if (_heightmap_cull_bounds(p_params, child_level, x, z)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
 void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callback, void *p_userdata, bool p_invert_backface_collision) const {
 	if (heights.is_empty()) {
 		return;
@@ -2033,22 +2156,32 @@ void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callb
 	face.backface_collision = !p_invert_backface_collision;
 	face.invert_backface_collision = p_invert_backface_collision;
 
-	for (int z = start_z; z < end_z; z++) {
-		for (int x = start_x; x < end_x; x++) {
-			// First triangle.
-			_get_point(x, z, face.vertex[0]);
-			_get_point(x + 1, z, face.vertex[1]);
-			_get_point(x, z + 1, face.vertex[2]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
-			}
+	_HeightmapCullParams params;
+	params.start_x = start_x;
+	params.end_x = end_x;
+	params.start_z = start_z;
+	params.end_z = end_z;
+	params.min_y = local_aabb.position.y;
+	params.max_y = local_aabb.position.y + local_aabb.size.y;
+	params.callback = p_callback;
+	params.userdata = p_userdata;
+	params.heightmap = this;
+	params.face = &face;
 
-			// Second triangle.
-			face.vertex[0] = face.vertex[1];
-			_get_point(x + 1, z + 1, face.vertex[1]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
+	if (bounds_grid.is_empty()) {
+		_heightmap_cull_cells(params, start_x, end_x, start_z, end_z);
+		return;
+	}
+
+	// Walk down from the coarsest level, skipping areas entirely above or below the AABB.
+	int top_level = bounds_mips.size();
+	int top_size = BOUNDS_CHUNK_SIZE << top_level;
+	int top_width = (top_level == 0) ? bounds_grid_width : bounds_mips[top_level - 1].width;
+	int top_depth = (top_level == 0) ? bounds_grid_depth : bounds_mips[top_level - 1].depth;
+
+	for (int z = MAX(start_z / top_size, 0); z < MIN((end_z + top_size - 1) / top_size, top_depth); z++) {
+		for (int x = MAX(start_x / top_size, 0); x < MIN((end_x + top_size - 1) / top_size, top_width); x++) {
+			if (_heightmap_cull_bounds(params, top_level, x, z)) {
 				return;
 			}
 		}
@@ -2067,6 +2200,7 @@ Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 
 void GodotHeightMapShape3D::_build_accelerator() {
 	bounds_grid.clear();
+	bounds_mips.clear();
 
 	bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
 	bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
@@ -2132,6 +2266,36 @@ void GodotHeightMapShape3D::_build_accelerator() {
 			bounds_grid[cx + cz * bounds_grid_width] = r;
 		}
 	}
+
+	// Merge 2x2 ranges into coarser levels, until the whole terrain is covered by a few of them.
+	int level_width = bounds_grid_width;
+	int level_depth = bounds_grid_depth;
+	while (level_width > 2 || level_depth > 2) {
+		const LocalVector<Range> &child_ranges = bounds_mips.is_empty() ? bounds_grid : bounds_mips[bounds_mips.size() - 1].ranges;
+
+		BoundsLevel level;
+		level.width = (level_width + 1) / 2;
+		level.depth = (level_depth + 1) / 2;
+		level.ranges.resize(level.width * level.depth);
+
+		for (int z = 0; z < level.depth; ++z) {
+			for (int x = 0; x < level.width; ++x) {
+				Range r = child_ranges[(z * 2) * level_width + (x * 2)];
+				for (int cz = z * 2; cz < MIN(z * 2 + 2, level_depth); ++cz) {
+					for (int cx = x * 2; cx < MIN(x * 2 + 2, level_width); ++cx) {
+						const Range &child = child_ranges[cz * level_width + cx];
+						r.min = MIN(r.min, child.min);
+						r.max = MAX(r.max, child.max);
+					}
+				}
+				level.ranges[z * level.width + x] = r;
+			}
+		}
+
+		level_width = level.width;
+		level_depth = level.depth;
+		bounds_mips.push_back(level);
+	}
 }
 
 void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height) {
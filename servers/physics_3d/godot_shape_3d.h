@@ -314,25 +314,32 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 	};
 
 	Vector<Face> faces;
-	Vector<Vector3> vertices;
+	Vector<Vector3> vertices; // Shared between faces.
 
+	// Nodes are stored in depth-first order, so the first child of a node directly follows it.
+	// Bounds are quantized to 16 bits inside the shape's AABB.
 	struct BVH {
-		AABB aabb;
-		int left = 0;
-		int right = 0;
-
-		int face_index = 0;
+		uint16_t min[3] = {};
+		uint16_t max[3] = {};
+		// Index of the face for leaves. Other nodes store -(index of the node following their
+		// subtree) instead, which lets the tree be traversed without a stack.
+		int32_t face_index = 0;
 	};
 
 	Vector<BVH> bvh;
+	Vector3 bvh_origin;
+	Vector3 bvh_scale; // Local space to quantized space.
+	Vector3 bvh_inv_scale;
 
 	struct _CullParams {
-		AABB aabb;
+		uint16_t aabb_min[3] = {};
+		uint16_t aabb_max[3] = {};
 		QueryCallback callback = nullptr;
 		void *userdata = nullptr;
 		const Face *faces = nullptr;
 		const Vector3 *vertices = nullptr;
 		const BVH *bvh = nullptr;
+		int bvh_count = 0;
 		GodotFaceShape3D *face = nullptr;
 	};
 
@@ -343,6 +350,7 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 		const Face *faces = nullptr;
 		const Vector3 *vertices = nullptr;
 		const BVH *bvh = nullptr;
+		int bvh_count = 0;
 		GodotFaceShape3D *face = nullptr;
 
 		Vector3 result;
@@ -353,8 +361,11 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 
 	bool backface_collision = false;
 
-	void _cull_segment(int p_idx, _SegmentCullParams *p_params) const;
-	bool _cull(int p_idx, _CullParams *p_params) const;
+	void _quantize_aabb(const AABB &p_aabb, uint16_t *r_min, uint16_t *r_max) const;
+	AABB _get_bvh_aabb(const BVH &p_node) const;
+
+	void _cull_segment(_SegmentCullParams *p_params) const;
+	bool _cull(_CullParams *p_params) const;
 
 	void _fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx);
 
@@ -399,6 +410,15 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 
 	static const int BOUNDS_CHUNK_SIZE = 16;
 
+	// Coarser levels above the bounds grid, each one merging 2x2 ranges of the level below,
+	// so that culling can reject large areas of the terrain at once.
+	struct BoundsLevel {
+		LocalVector<Range> ranges;
+		int width = 0;
+		int depth = 0;
+	};
+	LocalVector<BoundsLevel> bounds_mips;
+
 	_FORCE_INLINE_ const Range &_get_bounds_chunk(int p_x, int p_z) const {
 		return bounds_grid[(p_z * bounds_grid_width) + p_x];
 	}
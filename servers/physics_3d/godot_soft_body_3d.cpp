@@ -33,9 +33,12 @@
 #include "godot_space_3d.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/rb_map.h"
 #include "servers/rendering_server.h"
 
+#define LINK_CHUNK_SIZE 256
+
 // Based on Bullet soft body.
 
 /*
@@ -291,6 +294,19 @@ void GodotSoftBody3D::update_link_constants() {
 		Link &link = links[i];
 		link.c0 = (link.n[0]->im + link.n[1]->im) * inv_linear_stiffness;
 	}
+
+	uint32_t link_count = links.size();
+	link_node_a.resize(link_count);
+	link_node_b.resize(link_count);
+	link_c0.resize(link_count);
+	link_c1.resize(link_count);
+	for (uint32_t i = 0; i < link_count; ++i) {
+		const Link &link = links[i];
+		link_node_a[i] = link.n[0] - &nodes[0];
+		link_node_b[i] = link.n[1] - &nodes[0];
+		link_c0[i] = link.c0;
+		link_c1[i] = link.c1;
+	}
 }
 
 void GodotSoftBody3D::apply_nodes_transform(const Transform3D &p_transform) {
@@ -477,6 +493,29 @@ Vector3 GodotSoftBody3D::get_face_normal(uint32_t p_face_index) const {
 	return faces[p_face_index].normal;
 }
 
+uint32_t GodotSoftBody3D::get_link_count() const {
+	return links.size();
+}
+
+void GodotSoftBody3D::get_link_nodes(uint32_t p_link_index, uint32_t &r_node_a, uint32_t &r_node_b) const {
+	ERR_FAIL_UNSIGNED_INDEX(p_link_index, links.size());
+	const Link &link = links[p_link_index];
+	r_node_a = link.n[0] - &nodes[0];
+	r_node_b = link.n[1] - &nodes[0];
+}
+
+uint32_t GodotSoftBody3D::get_link_batch_count() const {
+	return link_batches.size();
+}
+
+void GodotSoftBody3D::get_link_batch(uint32_t p_batch_index, uint32_t &r_begin, uint32_t &r_count, bool &r_independent) const {
+	ERR_FAIL_UNSIGNED_INDEX(p_batch_index, link_batches.size());
+	const LinkBatch &batch = link_batches[p_batch_index];
+	r_begin = batch.begin;
+	r_count = batch.count;
+	r_independent = batch.independent;
+}
+
 bool GodotSoftBody3D::create_from_trimesh(const Vector<int> &p_indices, const Vector<Vector3> &p_vertices) {
 	ERR_FAIL_COND_V(p_indices.is_empty(), false);
 	ERR_FAIL_COND_V(p_vertices.is_empty(), false);
@@ -588,7 +627,7 @@ bool GodotSoftBody3D::create_from_trimesh(const Vector<int> &p_indices, const Ve
 	}
 
 	generate_bending_constraints(2);
-	reoptimize_link_order();
+	color_links();
 
 	update_constants();
 	update_normals_and_centroids();
@@ -696,142 +735,70 @@ void GodotSoftBody3D::generate_bending_constraints(int p_distance) {
 	}
 }
 
-//===================================================================
-//
-//
-// This function takes in a list of interdependent Links and tries
-// to maximize the distance between calculation
-// of dependent links. This increases the amount of parallelism that can
-// be exploited by out-of-order instruction processors with large but
-// (inevitably) finite instruction windows.
-//
-//===================================================================
-
-// A small structure to track lists of dependent link calculations.
-class LinkDeps {
-public:
-	// A link calculation that is dependent on this one.
-	// Positive values = "input A" while negative values = "input B".
-	int value;
-	// Next dependence in the list.
-	LinkDeps *next;
-};
-typedef LinkDeps *LinkDepsPtr;
+// Greedy coloring of the links, so that no two links of the same color share a
+// node. The links are then sorted by color, and each color is a batch that can
+// be solved in parallel.
+void GodotSoftBody3D::color_links() {
+	const uint32_t max_colors = 64;
 
-void GodotSoftBody3D::reoptimize_link_order() {
-	const int reop_not_dependent = -1;
-	const int reop_node_complete = -2;
+	link_batches.clear();
 
 	uint32_t link_count = links.size();
-	uint32_t node_count = nodes.size();
-
-	if (link_count < 1 || node_count < 2) {
+	if (link_count == 0) {
 		return;
 	}
 
-	uint32_t i;
-	Link *lr;
-	int ar, br;
-	Node *node0 = &(nodes[0]);
-	Node *node1 = &(nodes[1]);
-	LinkDepsPtr link_dep;
-	int ready_list_head, ready_list_tail, link_num, link_dep_frees, dep_link;
-
-	// Allocate temporary buffers.
-	int *node_written_at = memnew_arr(int, node_count + 1); // What link calculation produced this node's current values?
-	int *link_dep_A = memnew_arr(int, link_count); // Link calculation input is dependent upon prior calculation #N
-	int *link_dep_B = memnew_arr(int, link_count);
-	int *ready_list = memnew_arr(int, link_count); // List of ready-to-process link calculations (# of links, maximum)
-	LinkDeps *link_dep_free_list = memnew_arr(LinkDeps, 2 * link_count); // Dependent-on-me list elements (2x# of links, maximum)
-	LinkDepsPtr *link_dep_list_starts = memnew_arr(LinkDepsPtr, link_count); // Start nodes of dependent-on-me lists, one for each link
-
-	// Copy the original, unsorted links to a side buffer.
-	Link *link_buffer = memnew_arr(Link, link_count);
-	memcpy(link_buffer, &(links[0]), sizeof(Link) * link_count);
-
-	// Clear out the node setup and ready list.
-	for (i = 0; i < node_count + 1; i++) {
-		node_written_at[i] = reop_not_dependent;
-	}
-	for (i = 0; i < link_count; i++) {
-		link_dep_list_starts[i] = nullptr;
-	}
-	ready_list_head = ready_list_tail = link_dep_frees = 0;
-
-	// Initial link analysis to set up data structures.
-	for (i = 0; i < link_count; i++) {
-		// Note which prior link calculations we are dependent upon & build up dependence lists.
-		lr = &(links[i]);
-		ar = (lr->n[0] - node0) / (node1 - node0);
-		br = (lr->n[1] - node0) / (node1 - node0);
-		if (node_written_at[ar] > reop_not_dependent) {
-			link_dep_A[i] = node_written_at[ar];
-			link_dep = &link_dep_free_list[link_dep_frees++];
-			link_dep->value = i;
-			link_dep->next = link_dep_list_starts[node_written_at[ar]];
-			link_dep_list_starts[node_written_at[ar]] = link_dep;
-		} else {
-			link_dep_A[i] = reop_not_dependent;
-		}
-		if (node_written_at[br] > reop_not_dependent) {
-			link_dep_B[i] = node_written_at[br];
-			link_dep = &link_dep_free_list[link_dep_frees++];
-			link_dep->value = -(int)(i + 1);
-			link_dep->next = link_dep_list_starts[node_written_at[br]];
-			link_dep_list_starts[node_written_at[br]] = link_dep;
-		} else {
-			link_dep_B[i] = reop_not_dependent;
-		}
+	LocalVector<uint64_t> node_colors;
+	node_colors.resize(nodes.size());
+	memset(node_colors.ptr(), 0, node_colors.size() * sizeof(uint64_t));
 
-		// Add this link to the initial ready list, if it is not dependent on any other links.
-		if ((link_dep_A[i] == reop_not_dependent) && (link_dep_B[i] == reop_not_dependent)) {
-			ready_list[ready_list_tail++] = i;
-			link_dep_A[i] = link_dep_B[i] = reop_node_complete; // Probably not needed now.
-		}
+	LocalVector<uint32_t> link_colors;
+	link_colors.resize(link_count);
 
-		// Update the nodes to mark which ones are calculated by this link.
-		node_written_at[ar] = node_written_at[br] = i;
-	}
-
-	// Process the ready list and create the sorted list of links:
-	// -- By treating the ready list as a queue, we maximize the distance between any
-	//    inter-dependent node calculations.
-	// -- All other (non-related) nodes in the ready list will automatically be inserted
-	//    in between each set of inter-dependent link calculations by this loop.
-	i = 0;
-	while (ready_list_head != ready_list_tail) {
-		// Use ready list to select the next link to process.
-		link_num = ready_list[ready_list_head++];
-		// Copy the next-to-calculate link back into the original link array.
-		links[i++] = link_buffer[link_num];
-
-		// Free up any link inputs that are dependent on this one.
-		link_dep = link_dep_list_starts[link_num];
-		while (link_dep) {
-			dep_link = link_dep->value;
-			if (dep_link >= 0) {
-				link_dep_A[dep_link] = reop_not_dependent;
-			} else {
-				dep_link = -dep_link - 1;
-				link_dep_B[dep_link] = reop_not_dependent;
-			}
-			// Add this dependent link calculation to the ready list if *both* inputs are clear.
-			if ((link_dep_A[dep_link] == reop_not_dependent) && (link_dep_B[dep_link] == reop_not_dependent)) {
-				ready_list[ready_list_tail++] = dep_link;
-				link_dep_A[dep_link] = link_dep_B[dep_link] = reop_node_complete; // Probably not needed now.
+	// The extra color holds the links that didn't fit, they are solved serially.
+	uint32_t color_counts[max_colors + 1] = {};
+
+	const Node *node0 = &nodes[0];
+	for (uint32_t i = 0; i < link_count; i++) {
+		const uint32_t a = links[i].n[0] - node0;
+		const uint32_t b = links[i].n[1] - node0;
+
+		uint32_t color = max_colors;
+		const uint64_t used = node_colors[a] | node_colors[b];
+		if (used != UINT64_MAX) {
+			color = 0;
+			while (used & (uint64_t(1) << color)) {
+				color++;
 			}
-			link_dep = link_dep->next;
+			node_colors[a] |= uint64_t(1) << color;
+			node_colors[b] |= uint64_t(1) << color;
 		}
+
+		link_colors[i] = color;
+		color_counts[color]++;
 	}
 
-	// Delete the temporary buffers.
-	memdelete_arr(node_written_at);
-	memdelete_arr(link_dep_A);
-	memdelete_arr(link_dep_B);
-	memdelete_arr(ready_list);
-	memdelete_arr(link_dep_free_list);
-	memdelete_arr(link_dep_list_starts);
-	memdelete_arr(link_buffer);
+	uint32_t color_offsets[max_colors + 1];
+	uint32_t offset = 0;
+	for (uint32_t color = 0; color <= max_colors; color++) {
+		color_offsets[color] = offset;
+		if (color_counts[color] > 0) {
+			LinkBatch batch;
+			batch.begin = offset;
+			batch.count = color_counts[color];
+			batch.independent = color < max_colors;
+			link_batches.push_back(batch);
+		}
+		offset += color_counts[color];
+	}
+
+	// Stable, so links keep their relative order within a batch.
+	LocalVector<Link> sorted_links;
+	sorted_links.resize(link_count);
+	for (uint32_t i = 0; i < link_count; i++) {
+		sorted_links[color_offsets[link_colors[i]]++] = links[i];
+	}
+	links = sorted_links;
 }
 
 void GodotSoftBody3D::append_link(uint32_t p_node1, uint32_t p_node2) {
@@ -1085,33 +1052,31 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 	face_tree.optimize_incremental(1);
 }
 
-void GodotSoftBody3D::solve_constraints(real_t p_delta) {
+void GodotSoftBody3D::solve_constraints(real_t p_delta, bool p_use_threads) {
 	const real_t inv_delta = 1.0 / p_delta;
 
 	uint32_t i, ni;
 
-	for (i = 0, ni = links.size(); i < ni; ++i) {
-		Link &link = links[i];
-		link.c3 = link.n[1]->q - link.n[0]->q;
-		link.c2 = 1 / (link.c3.length_squared() * link.c0);
-	}
-
 	// Solve velocities.
-	for (i = 0, ni = nodes.size(); i < ni; ++i) {
-		Node &node = nodes[i];
-		node.x = node.q + node.v * p_delta;
+	ni = nodes.size();
+	solver_positions.resize(ni);
+	solver_inv_masses.resize(ni);
+	for (i = 0; i < ni; ++i) {
+		const Node &node = nodes[i];
+		solver_positions[i] = node.q + node.v * p_delta;
+		solver_inv_masses[i] = node.im;
 	}
 
 	// Solve positions.
 	for (int isolve = 0; isolve < iteration_count; ++isolve) {
 		const real_t ti = isolve / (real_t)iteration_count;
-		solve_links(1.0, ti);
+		solve_links(1.0, ti, p_use_threads);
 	}
 	const real_t vc = (1.0 - damping_coefficient) * inv_delta;
 	for (i = 0, ni = nodes.size(); i < ni; ++i) {
 		Node &node = nodes[i];
 
-		node.x += node.bv * p_delta;
+		node.x = solver_positions[i] + node.bv * p_delta;
 		node.bv = Vector3();
 
 		node.v = (node.x - node.q) * vc;
@@ -1122,18 +1087,47 @@ void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 	update_normals_and_centroids();
 }
 
-void GodotSoftBody3D::solve_links(real_t kst, real_t ti) {
-	for (uint32_t i = 0, ni = links.size(); i < ni; ++i) {
-		Link &link = links[i];
-		if (link.c0 > 0) {
-			Node &node_a = *link.n[0];
-			Node &node_b = *link.n[1];
-			const Vector3 del = node_b.x - node_a.x;
+void GodotSoftBody3D::solve_links(real_t kst, real_t ti, bool p_use_threads) {
+	for (uint32_t batch_index = 0; batch_index < link_batches.size(); ++batch_index) {
+		const LinkBatch &batch = link_batches[batch_index];
+		const uint32_t chunk_count = (batch.count + LINK_CHUNK_SIZE - 1) / LINK_CHUNK_SIZE;
+
+		if (p_use_threads && batch.independent && chunk_count > 1) {
+			LinkChunkParams params;
+			params.begin = batch.begin;
+			params.end = batch.begin + batch.count;
+			params.kst = kst;
+
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotSoftBody3D::solve_link_chunk, &params, chunk_count, -1, true, SNAME("SoftBody3DSolveLinks"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			solve_link_range(batch.begin, batch.begin + batch.count, kst);
+		}
+	}
+}
+
+void GodotSoftBody3D::solve_link_chunk(uint32_t p_chunk_index, const LinkChunkParams *p_params) {
+	const uint32_t begin = p_params->begin + p_chunk_index * LINK_CHUNK_SIZE;
+	const uint32_t end = MIN(begin + LINK_CHUNK_SIZE, p_params->end);
+	solve_link_range(begin, end, p_params->kst);
+}
+
+void GodotSoftBody3D::solve_link_range(uint32_t p_begin, uint32_t p_end, real_t p_kst) {
+	Vector3 *positions = solver_positions.ptr();
+	const real_t *inv_masses = solver_inv_masses.ptr();
+
+	for (uint32_t i = p_begin; i < p_end; ++i) {
+		const real_t c0 = link_c0[i];
+		if (c0 > 0) {
+			const uint32_t a = link_node_a[i];
+			const uint32_t b = link_node_b[i];
+			const Vector3 del = positions[b] - positions[a];
 			const real_t len = del.length_squared();
-			if (link.c1 + len > CMP_EPSILON) {
-				const real_t k = ((link.c1 - len) / (link.c0 * (link.c1 + len))) * kst;
-				node_a.x -= del * (k * node_a.im);
-				node_b.x += del * (k * node_b.im);
+			const real_t c1 = link_c1[i];
+			if (c1 + len > CMP_EPSILON) {
+				const real_t k = ((c1 - len) / (c0 * (c1 + len))) * p_kst;
+				positions[a] -= del * (k * inv_masses[a]);
+				positions[b] += del * (k * inv_masses[b]);
 			}
 		}
 	}
@@ -1252,6 +1246,12 @@ void GodotSoftBody3D::destroy() {
 	links.clear();
 	faces.clear();
 
+	link_batches.clear();
+	link_node_a.clear();
+	link_node_b.clear();
+	link_c0.clear();
+	link_c1.clear();
+
 	bounds = AABB();
 	deinitialize_shape();
 }
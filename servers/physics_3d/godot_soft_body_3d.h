@@ -61,12 +61,23 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 	};
 
 	struct Link {
-		Vector3 c3; // gradient
 		Node *n[2] = { nullptr, nullptr }; // Node pointers
 		real_t rl = 0.0; // Rest length
 		real_t c0 = 0.0; // (ima+imb)*kLST
 		real_t c1 = 0.0; // rl^2
-		real_t c2 = 0.0; // |gradient|^2/c0
+	};
+
+	// Links in a batch share no node, so they can be solved in any order.
+	struct LinkBatch {
+		uint32_t begin = 0;
+		uint32_t count = 0;
+		bool independent = true; // False for the links that ran out of colors.
+	};
+
+	struct LinkChunkParams {
+		uint32_t begin = 0;
+		uint32_t end = 0;
+		real_t kst = 0.0;
 	};
 
 	struct Face {
@@ -82,6 +93,18 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 	LocalVector<Link> links;
 	LocalVector<Face> faces;
 
+	LocalVector<LinkBatch> link_batches;
+
+	// Link data used by the solver, split from the links and stored in batch order.
+	LocalVector<uint32_t> link_node_a;
+	LocalVector<uint32_t> link_node_b;
+	LocalVector<real_t> link_c0;
+	LocalVector<real_t> link_c1;
+
+	// Node positions and inverse masses, gathered from the nodes while the links are solved.
+	LocalVector<Vector3> solver_positions;
+	LocalVector<real_t> solver_inv_masses;
+
 	DynamicBVH node_tree;
 	DynamicBVH face_tree;
 
@@ -179,6 +202,11 @@ public:
 	void get_face_points(uint32_t p_face_index, Vector3 &r_point_1, Vector3 &r_point_2, Vector3 &r_point_3) const;
 	Vector3 get_face_normal(uint32_t p_face_index) const;
 
+	uint32_t get_link_count() const;
+	void get_link_nodes(uint32_t p_link_index, uint32_t &r_node_a, uint32_t &r_node_b) const;
+	uint32_t get_link_batch_count() const;
+	void get_link_batch(uint32_t p_batch_index, uint32_t &r_begin, uint32_t &r_count, bool &r_independent) const;
+
 	void set_iteration_count(int p_val);
 	_FORCE_INLINE_ real_t get_iteration_count() const { return iteration_count; }
 
@@ -202,7 +230,7 @@ public:
 	_FORCE_INLINE_ real_t get_drag_coefficient() const { return drag_coefficient; }
 
 	void predict_motion(real_t p_delta);
-	void solve_constraints(real_t p_delta);
+	void solve_constraints(real_t p_delta, bool p_use_threads = true);
 
 	_FORCE_INLINE_ uint32_t get_node_index(void *p_node) const { return static_cast<Node *>(p_node)->index; }
 	_FORCE_INLINE_ uint32_t get_face_index(void *p_face) const { return static_cast<Face *>(p_face)->index; }
@@ -233,11 +261,13 @@ private:
 
 	bool create_from_trimesh(const Vector<int> &p_indices, const Vector<Vector3> &p_vertices);
 	void generate_bending_constraints(int p_distance);
-	void reoptimize_link_order();
+	void color_links();
 	void append_link(uint32_t p_node1, uint32_t p_node2);
 	void append_face(uint32_t p_node1, uint32_t p_node2, uint32_t p_node3);
 
-	void solve_links(real_t kst, real_t ti);
+	void solve_links(real_t kst, real_t ti, bool p_use_threads);
+	void solve_link_range(uint32_t p_begin, uint32_t p_end, real_t p_kst);
+	void solve_link_chunk(uint32_t p_chunk_index, const LinkChunkParams *p_params);
 
 	void initialize_face_tree();
 	void update_face_tree(real_t p_delta);
@@ -41,17 +41,54 @@
 
 #include "core/config/project_settings.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/safe_refcount.h"
 #include "core/typedefs.h"
 
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
 	GDCLASS(GodotPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3D);
 
+	// Where a query gathers the objects found in the broadphase. Single queries use the space's arrays,
+	// batched queries give each task its own so they can run at the same time.
+	struct QueryBuffer {
+		GodotCollisionObject3D **objects = nullptr;
+		int *subindices = nullptr;
+		bool concurrent = false;
+	};
+
+	struct RayBatch {
+		const RayParameters *parameters = nullptr;
+		const Vector3 *from = nullptr;
+		const Vector3 *to = nullptr;
+		RayResult *results = nullptr;
+		bool *hits = nullptr;
+		const uint32_t *order = nullptr;
+		uint32_t count = 0;
+	};
+
+	struct ShapeBatch {
+		const ShapeParameters *parameters = nullptr;
+		const GodotShape3D *shape = nullptr;
+		const Transform3D *transforms = nullptr;
+		ShapeResult *results = nullptr;
+		int result_max = 0;
+		int *result_counts = nullptr;
+		const uint32_t *order = nullptr;
+		uint32_t count = 0;
+	};
+
+	bool _intersect_ray(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, RayResult &r_result, const QueryBuffer &p_buffer) const;
+	int _intersect_shape(const ShapeParameters &p_parameters, const GodotShape3D *p_shape, const Transform3D &p_transform, ShapeResult *r_results, int p_result_max, const QueryBuffer &p_buffer) const;
+	void _intersect_ray_chunk(uint32_t p_chunk, RayBatch *p_batch);
+	void _intersect_shape_chunk(uint32_t p_chunk, ShapeBatch *p_batch);
+
 public:
 	GodotSpace3D *space = nullptr;
 
 	virtual int intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
 	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) override;
+	virtual void intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) override;
 	virtual int intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
+	virtual void intersect_shapes(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) override;
 	virtual bool cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info = nullptr) override;
 	virtual bool collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) override;
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) override;
@@ -86,6 +123,9 @@ private:
 	SelfList<GodotArea3D>::List area_moved_list;
 	SelfList<GodotSoftBody3D>::List active_soft_body_list;
 
+	// Pairs that didn't collide but have a CCD body, swept once velocities are solved.
+	LocalVector<GodotBodyPair3D *> ccd_pairs;
+
 	static void *_broadphase_pair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_self);
 	static void _broadphase_unpair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_data, void *p_self);
 
@@ -94,6 +134,12 @@ private:
 	GodotArea3D *area = nullptr;
 
 	int solver_iterations = 0;
+	bool deterministic = false;
+	real_t narrowphase_cache_threshold = 0.0;
+
+	// Updated from the constraint setup tasks, hence atomic.
+	SafeNumeric<uint32_t> narrowphase_cache_hits;
+	SafeNumeric<uint32_t> narrowphase_cache_misses;
 
 	real_t contact_recycle_radius = 0.0;
 	real_t contact_max_separation = 0.0;
@@ -117,6 +163,7 @@ private:
 
 	int island_count = 0;
 	int active_objects = 0;
+	int sleeping_objects = 0;
 	int collision_pairs = 0;
 
 	RID static_global_body;
@@ -161,6 +208,9 @@ public:
 	const HashSet<GodotCollisionObject3D *> &get_objects() const;
 
 	_FORCE_INLINE_ int get_solver_iterations() const { return solver_iterations; }
+	_FORCE_INLINE_ void set_deterministic(bool p_enabled) { deterministic = p_enabled; }
+	_FORCE_INLINE_ bool is_deterministic() const { return deterministic; }
+	_FORCE_INLINE_ real_t get_narrowphase_cache_threshold() const { return narrowphase_cache_threshold; }
 	_FORCE_INLINE_ real_t get_contact_recycle_radius() const { return contact_recycle_radius; }
 	_FORCE_INLINE_ real_t get_contact_max_separation() const { return contact_max_separation; }
 	_FORCE_INLINE_ real_t get_contact_max_allowed_penetration() const { return contact_max_allowed_penetration; }
@@ -189,8 +239,29 @@ public:
 	void set_active_objects(int p_active_objects) { active_objects = p_active_objects; }
 	int get_active_objects() const { return active_objects; }
 
+	void add_sleeping_objects(int p_count) { sleeping_objects += p_count; }
+	int get_sleeping_objects() const { return sleeping_objects; }
+
 	int get_collision_pairs() const { return collision_pairs; }
 
+	void add_ccd_pair(GodotBodyPair3D *p_pair) { ccd_pairs.push_back(p_pair); }
+	const LocalVector<GodotBodyPair3D *> &get_ccd_pairs() const { return ccd_pairs; }
+	void clear_ccd_pairs() { ccd_pairs.clear(); }
+
+	_FORCE_INLINE_ void add_narrowphase_cache_result(bool p_hit) {
+		if (p_hit) {
+			narrowphase_cache_hits.increment();
+		} else {
+			narrowphase_cache_misses.increment();
+		}
+	}
+	void reset_narrowphase_cache_stats() {
+		narrowphase_cache_hits.set(0);
+		narrowphase_cache_misses.set(0);
+	}
+	int get_narrowphase_cache_hits() const { return narrowphase_cache_hits.get(); }
+	int get_narrowphase_cache_misses() const { return narrowphase_cache_misses.get(); }
+
 	GodotPhysicsDirectSpaceState3D *get_direct_state();
 
 	void set_debug_contacts(int p_amount) { contact_debug.resize(p_amount); }
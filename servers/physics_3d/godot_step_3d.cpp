@@ -40,6 +40,18 @@
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
 
+struct BodyIDComparator3D {
+	_FORCE_INLINE_ bool operator()(const GodotBody3D *p_a, const GodotBody3D *p_b) const {
+		return p_a->get_self().get_id() < p_b->get_self().get_id();
+	}
+};
+
+struct ConstraintKeyComparator3D {
+	_FORCE_INLINE_ bool operator()(const GodotConstraint3D *p_a, const GodotConstraint3D *p_b) const {
+		return p_a->get_sort_key() < p_b->get_sort_key();
+	}
+};
+
 void GodotStep3D::_populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
 
@@ -111,6 +123,43 @@ void GodotStep3D::_populate_island_soft_body(GodotSoftBody3D *p_soft_body, Local
 	}
 }
 
+void GodotStep3D::_fill_active_bodies(const SelfList<GodotBody3D>::List *p_body_list) {
+	active_bodies.clear();
+	const SelfList<GodotBody3D> *b = p_body_list->first();
+	while (b) {
+		active_bodies.push_back(b->self());
+		b = b->next();
+	}
+
+	if (deterministic) {
+		// The active list is ordered by activation, which depends on the history of the space.
+		active_bodies.sort_custom<BodyIDComparator3D>();
+	}
+}
+
+void GodotStep3D::_sort_islands(uint32_t p_island_count) {
+	island_order.resize(p_island_count);
+	for (uint32_t island_index = 0; island_index < p_island_count; ++island_index) {
+		LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[island_index];
+		if (deterministic) {
+			constraint_island.sort_custom<ConstraintKeyComparator3D>();
+			island_order[island_index].key = constraint_island[0]->get_sort_key();
+		}
+		island_order[island_index].index = island_index;
+	}
+	if (deterministic) {
+		island_order.sort();
+	}
+}
+
+void GodotStep3D::_integrate_forces(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_forces(delta);
+}
+
+void GodotStep3D::_integrate_velocities(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_velocities(delta);
+}
+
 void GodotStep3D::_setup_constraint(uint32_t p_constraint_index, void *p_userdata) {
 	GodotConstraint3D *constraint = all_constraints[p_constraint_index];
 	constraint->setup(delta);
@@ -181,6 +230,65 @@ void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island
 	}
 }
 
+void GodotStep3D::_solve_soft_body_constraints(uint32_t p_soft_body_index, void *p_userdata) {
+	// Already running on threads, one per soft body.
+	active_soft_bodies[p_soft_body_index]->solve_constraints(delta, false);
+}
+
+void GodotStep3D::_compute_time_of_impact(uint32_t p_impact_index, void *p_userdata) {
+	CCDImpact &impact = ccd_impacts[p_impact_index];
+	if (!impact.pair->get_time_of_impact(delta, impact.toi)) {
+		impact.toi = 1.0;
+	}
+}
+
+void GodotStep3D::_solve_continuous_collisions(GodotSpace3D *p_space) {
+	const LocalVector<GodotBodyPair3D *> &ccd_pairs = p_space->get_ccd_pairs();
+	if (ccd_pairs.is_empty()) {
+		return;
+	}
+
+	ccd_impacts.resize(ccd_pairs.size());
+	for (uint32_t i = 0; i < ccd_pairs.size(); i++) {
+		ccd_impacts[i].pair = ccd_pairs[i];
+		ccd_impacts[i].toi = 1.0;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_compute_time_of_impact, nullptr, ccd_impacts.size(), -1, true, SNAME("Physics3DContinuousCollisions"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Earliest impacts first. A body stopped short by one impact is swept
+	// again from its shortened motion by the pairs that come after it.
+	ccd_impacts.sort();
+
+	for (uint32_t i = 0; i < ccd_impacts.size(); i++) {
+		CCDImpact &impact = ccd_impacts[i];
+		GodotBody3D **bodies = impact.pair->get_body_ptr();
+
+		if (bodies[0]->get_ccd_motion_scale() < 1.0 || bodies[1]->get_ccd_motion_scale() < 1.0) {
+			if (!impact.pair->get_time_of_impact(delta, impact.toi)) {
+				continue;
+			}
+		}
+
+		if (impact.toi < 1.0) {
+			impact.pair->apply_time_of_impact(impact.toi);
+		}
+	}
+
+	// The scale is reset when integrating, make sure bodies that won't be integrated this step don't keep one.
+	for (uint32_t i = 0; i < ccd_impacts.size(); i++) {
+		GodotBody3D **bodies = ccd_impacts[i].pair->get_body_ptr();
+		for (int j = 0; j < 2; j++) {
+			if (!bodies[j]->is_active() || bodies[j]->get_mode() < PhysicsServer3D::BODY_MODE_RIGID) {
+				bodies[j]->set_ccd_motion_scale(1.0);
+			}
+		}
+	}
+
+	p_space->clear_ccd_pairs();
+}
+
 void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	p_space->lock(); // can't access space during this
 
@@ -189,6 +297,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	p_space->set_last_step(p_delta);
 
 	iterations = p_space->get_solver_iterations();
+	deterministic = p_space->is_deterministic();
 	delta = p_delta;
 
 	const SelfList<GodotBody3D>::List *body_list = &p_space->get_active_body_list();
@@ -200,13 +309,15 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
 	uint64_t profile_endtime = 0;
 
-	int active_count = 0;
+	_fill_active_bodies(body_list);
+	int active_count = active_bodies.size();
 
-	const SelfList<GodotBody3D> *b = body_list->first();
-	while (b) {
-		b->self()->integrate_forces(p_delta);
-		b = b->next();
-		active_count++;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_integrate_forces, nullptr, active_bodies.size(), -1, true, SNAME("Physics3DIntegrateForces"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Shapes are moved in the broadphase serially.
+	for (uint32_t i = 0; i < active_bodies.size(); i++) {
+		active_bodies[i]->finish_integrate_forces();
 	}
 
 	/* UPDATE SOFT BODY MOTION */
@@ -259,12 +370,13 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* GENERATE CONSTRAINT ISLANDS FOR ACTIVE RIGID BODIES */
 
-	b = body_list->first();
+	// Refilled, as the active list can change while pairs are processed.
+	_fill_active_bodies(body_list);
 
 	uint32_t body_island_count = 0;
 
-	while (b) {
-		GodotBody3D *body = b->self();
+	for (uint32_t i = 0; i < active_bodies.size(); i++) {
+		GodotBody3D *body = active_bodies[i];
 
 		if (body->get_island_step() != _step) {
 			++body_island_count;
@@ -293,7 +405,6 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 				--island_count;
 			}
 		}
-		b = b->next();
 	}
 
 	/* GENERATE CONSTRAINT ISLANDS FOR ACTIVE SOFT BODIES */
@@ -332,6 +443,9 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 		sb = sb->next();
 	}
 
+	// Constraints are gathered by walking hash maps, so their order only gets canonical once sorted.
+	_sort_islands(island_count);
+
 	p_space->set_island_count((int)island_count);
 
 	{ //profile
@@ -342,8 +456,10 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
+	p_space->reset_narrowphase_cache_stats();
+
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -356,7 +472,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	// Warning: This doesn't run on threads, because it involves thread-unsafe processing.
 	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
-		_pre_solve_island(constraint_islands[island_index]);
+		_pre_solve_island(constraint_islands[island_order[island_index].index]);
 	}
 
 	/* SOLVE CONSTRAINT ISLANDS */
@@ -366,6 +482,11 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
+	/* CONTINUOUS COLLISION DETECTION */
+
+	// Needs the solved velocities, and must happen before they are integrated.
+	_solve_continuous_collisions(p_space);
+
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_SOLVE_CONSTRAINTS, profile_endtime - profile_begtime);
@@ -374,11 +495,14 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* INTEGRATE VELOCITIES */
 
-	b = body_list->first();
-	while (b) {
-		const SelfList<GodotBody3D> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
-		b = n;
+	_fill_active_bodies(body_list);
+
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_integrate_velocities, nullptr, active_bodies.size(), -1, true, SNAME("Physics3DIntegrateVelocities"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Shapes are moved in the broadphase and bodies can be deactivated, which must be done serially.
+	for (uint32_t i = 0; i < active_bodies.size(); i++) {
+		active_bodies[i]->finish_integrate_velocities();
 	}
 
 	/* SLEEP / WAKE UP ISLANDS */
@@ -389,12 +513,21 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* UPDATE SOFT BODY CONSTRAINTS */
 
+	active_soft_bodies.clear();
 	sb = soft_body_list->first();
 	while (sb) {
-		sb->self()->solve_constraints(p_delta);
+		active_soft_bodies.push_back(sb->self());
 		sb = sb->next();
 	}
 
+	if (active_soft_bodies.size() == 1) {
+		// A single soft body solves its link batches on threads instead.
+		active_soft_bodies[0]->solve_constraints(p_delta);
+	} else if (active_soft_bodies.size() > 1) {
+		group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_soft_body_constraints, nullptr, active_soft_bodies.size(), -1, true, SNAME("Physics3DSoftBodyConstraints"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_INTEGRATE_VELOCITIES, profile_endtime - profile_begtime);
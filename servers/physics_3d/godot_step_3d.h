@@ -40,18 +40,49 @@ class GodotStep3D {
 	uint64_t _step = 1;
 
 	int iterations = 0;
+	bool deterministic = false;
 	real_t delta = 0.0;
 
 	LocalVector<LocalVector<GodotBody3D *>> body_islands;
 	LocalVector<LocalVector<GodotConstraint3D *>> constraint_islands;
 	LocalVector<GodotConstraint3D *> all_constraints;
+	LocalVector<GodotBody3D *> active_bodies;
+	LocalVector<GodotSoftBody3D *> active_soft_bodies;
+
+	struct IslandOrder {
+		GodotConstraint3D::SortKey key;
+		uint32_t index = 0;
+
+		_FORCE_INLINE_ bool operator<(const IslandOrder &p_other) const { return key < p_other.key; }
+	};
+	LocalVector<IslandOrder> island_order;
+
+	struct CCDImpact {
+		real_t toi = 1.0;
+		GodotBodyPair3D *pair = nullptr;
+
+		_FORCE_INLINE_ bool operator<(const CCDImpact &p_other) const {
+			if (toi != p_other.toi) {
+				return toi < p_other.toi;
+			}
+			return pair->get_sort_key() < p_other.pair->get_sort_key();
+		}
+	};
+	LocalVector<CCDImpact> ccd_impacts;
 
 	void _populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
 	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
+	void _fill_active_bodies(const SelfList<GodotBody3D>::List *p_body_list);
+	void _sort_islands(uint32_t p_island_count);
+	void _integrate_forces(uint32_t p_body_index, void *p_userdata = nullptr);
+	void _integrate_velocities(uint32_t p_body_index, void *p_userdata = nullptr);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
 	void _pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
 	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
+	void _solve_soft_body_constraints(uint32_t p_soft_body_index, void *p_userdata = nullptr);
+	void _compute_time_of_impact(uint32_t p_impact_index, void *p_userdata = nullptr);
+	void _solve_continuous_collisions(GodotSpace3D *p_space);
 
 public:
 	void step(GodotSpace3D *p_space, real_t p_delta);
@@ -348,6 +348,70 @@ Dictionary PhysicsDirectSpaceState2D::_intersect_ray(const Ref<PhysicsRayQueryPa
 	return d;
 }
 
+Dictionary PhysicsDirectSpaceState2D::_intersect_rays(const Ref<PhysicsRayQueryParameters2D> &p_ray_query, const PackedVector2Array &p_from, const PackedVector2Array &p_to) {
+	ERR_FAIL_COND_V(!p_ray_query.is_valid(), Dictionary());
+	ERR_FAIL_COND_V_MSG(p_from.size() != p_to.size(), Dictionary(), "The ray start and end arrays must have the same size.");
+
+	int count = p_from.size();
+	Vector<RayResult> results;
+	results.resize(count);
+	Vector<bool> hits;
+	hits.resize(count);
+	hits.fill(false);
+
+	intersect_rays(p_ray_query->get_parameters(), p_from.ptr(), p_to.ptr(), count, results.ptrw(), hits.ptrw());
+
+	PackedByteArray hit;
+	PackedVector2Array position;
+	PackedVector2Array normal;
+	PackedInt64Array collider_id;
+	PackedInt32Array shape;
+	TypedArray<RID> rid;
+	hit.resize(count);
+	position.resize(count);
+	normal.resize(count);
+	collider_id.resize(count);
+	shape.resize(count);
+	rid.resize(count);
+
+	for (int i = 0; i < count; i++) {
+		hit.write[i] = hits[i];
+		if (!hits[i]) {
+			position.write[i] = Vector2();
+			normal.write[i] = Vector2();
+			collider_id.write[i] = 0;
+			shape.write[i] = -1;
+			rid[i] = RID();
+			continue;
+		}
+		const RayResult &result = results[i];
+		position.write[i] = result.position;
+		normal.write[i] = result.normal;
+		collider_id.write[i] = result.collider_id;
+		shape.write[i] = result.shape;
+		rid[i] = result.rid;
+	}
+
+	Dictionary d;
+	d["hit"] = hit;
+	d["position"] = position;
+	d["normal"] = normal;
+	d["collider_id"] = collider_id;
+	d["shape"] = shape;
+	d["rid"] = rid;
+
+	return d;
+}
+
+void PhysicsDirectSpaceState2D::intersect_rays(const RayParameters &p_parameters, const Vector2 *p_from, const Vector2 *p_to, int p_count, RayResult *r_results, bool *r_hits) {
+	RayParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.from = p_from[i];
+		parameters.to = p_to[i];
+		r_hits[i] = intersect_ray(parameters, r_results[i]);
+	}
+}
+
 TypedArray<Dictionary> PhysicsDirectSpaceState2D::_intersect_point(const Ref<PhysicsPointQueryParameters2D> &p_point_query, int p_max_results) {
 	ERR_FAIL_COND_V(p_point_query.is_null(), Array());
 
@@ -393,6 +457,56 @@ TypedArray<Dictionary> PhysicsDirectSpaceState2D::_intersect_shape(const Ref<Phy
 	return ret;
 }
 
+Dictionary PhysicsDirectSpaceState2D::_intersect_shapes(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query, const PackedVector2Array &p_positions, int p_max_results) {
+	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Dictionary());
+	ERR_FAIL_COND_V(p_max_results < 0, Dictionary());
+
+	int count = p_positions.size();
+	Vector<Transform2D> transforms;
+	transforms.resize(count);
+	for (int i = 0; i < count; i++) {
+		Transform2D transform = p_shape_query->get_transform();
+		transform.set_origin(p_positions[i]);
+		transforms.write[i] = transform;
+	}
+
+	Vector<ShapeResult> sr;
+	sr.resize(count * p_max_results);
+	PackedInt32Array counts;
+	counts.resize(count);
+	counts.fill(0);
+
+	intersect_shapes(p_shape_query->get_parameters(), transforms.ptr(), count, sr.ptrw(), p_max_results, counts.ptrw());
+
+	PackedInt64Array collider_id;
+	PackedInt32Array shape;
+	TypedArray<RID> rid;
+	for (int i = 0; i < count; i++) {
+		for (int j = 0; j < counts[i]; j++) {
+			const ShapeResult &result = sr[i * p_max_results + j];
+			collider_id.push_back(result.collider_id);
+			shape.push_back(result.shape);
+			rid.push_back(result.rid);
+		}
+	}
+
+	Dictionary d;
+	d["count"] = counts;
+	d["collider_id"] = collider_id;
+	d["shape"] = shape;
+	d["rid"] = rid;
+
+	return d;
+}
+
+void PhysicsDirectSpaceState2D::intersect_shapes(const ShapeParameters &p_parameters, const Transform2D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	ShapeParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.transform = p_transforms[i];
+		r_result_counts[i] = intersect_shape(parameters, r_results + i * p_result_max, p_result_max);
+	}
+}
+
 Vector<real_t> PhysicsDirectSpaceState2D::_cast_motion(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query) {
 	ERR_FAIL_COND_V(!p_shape_query.is_valid(), Vector<real_t>());
 
@@ -453,7 +567,9 @@ PhysicsDirectSpaceState2D::PhysicsDirectSpaceState2D() {
 void PhysicsDirectSpaceState2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("intersect_point", "parameters", "max_results"), &PhysicsDirectSpaceState2D::_intersect_point, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("intersect_ray", "parameters"), &PhysicsDirectSpaceState2D::_intersect_ray);
+	ClassDB::bind_method(D_METHOD("intersect_rays", "parameters", "from", "to"), &PhysicsDirectSpaceState2D::_intersect_rays);
 	ClassDB::bind_method(D_METHOD("intersect_shape", "parameters", "max_results"), &PhysicsDirectSpaceState2D::_intersect_shape, DEFVAL(32));
+	ClassDB::bind_method(D_METHOD("intersect_shapes", "parameters", "positions", "max_results"), &PhysicsDirectSpaceState2D::_intersect_shapes, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState2D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState2D::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "parameters"), &PhysicsDirectSpaceState2D::_get_rest_info);
@@ -613,6 +729,87 @@ bool PhysicsServer2D::_body_test_motion(RID p_body, const Ref<PhysicsTestMotionP
 	return body_test_motion(p_body, p_parameters->get_parameters(), result_ptr);
 }
 
+void PhysicsServer2D::body_set_states(const Vector<RID> &p_bodies, BodyState p_state, const Vector<Variant> &p_values) {
+	ERR_FAIL_COND(p_bodies.size() != p_values.size());
+	for (int i = 0; i < p_bodies.size(); i++) {
+		body_set_state(p_bodies[i], p_state, p_values[i]);
+	}
+}
+
+Vector<Variant> PhysicsServer2D::body_get_states(const Vector<RID> &p_bodies, BodyState p_state) const {
+	Vector<Variant> ret;
+	ret.resize(p_bodies.size());
+	Variant *w = ret.ptrw();
+	for (int i = 0; i < p_bodies.size(); i++) {
+		w[i] = body_get_state(p_bodies[i], p_state);
+	}
+	return ret;
+}
+
+void PhysicsServer2D::_body_set_states(const TypedArray<RID> &p_bodies, BodyState p_state, const Array &p_values) {
+	ERR_FAIL_COND(p_bodies.size() != p_values.size());
+	Vector<RID> bodies;
+	Vector<Variant> values;
+	bodies.resize(p_bodies.size());
+	values.resize(p_values.size());
+	for (int i = 0; i < p_bodies.size(); i++) {
+		bodies.write[i] = p_bodies[i];
+		values.write[i] = p_values[i];
+	}
+	body_set_states(bodies, p_state, values);
+}
+
+Array PhysicsServer2D::_body_get_states(const TypedArray<RID> &p_bodies, BodyState p_state) const {
+	Vector<RID> bodies;
+	bodies.resize(p_bodies.size());
+	for (int i = 0; i < p_bodies.size(); i++) {
+		bodies.write[i] = p_bodies[i];
+	}
+	Vector<Variant> values = body_get_states(bodies, p_state);
+	Array ret;
+	ret.resize(values.size());
+	for (int i = 0; i < values.size(); i++) {
+		ret[i] = values[i];
+	}
+	return ret;
+}
+
+void PhysicsServer2D::area_set_monitor_batch_callback(RID p_area, const Callable &p_callback) {
+	ERR_FAIL_MSG("Batched area monitoring is not supported by this physics server.");
+}
+
+void PhysicsServer2D::area_set_area_monitor_batch_callback(RID p_area, const Callable &p_callback) {
+	ERR_FAIL_MSG("Batched area monitoring is not supported by this physics server.");
+}
+
+Vector<RID> PhysicsServer2D::area_get_overlapping_bodies(RID p_area) const {
+	ERR_FAIL_V_MSG(Vector<RID>(), "Area overlap queries are not supported by this physics server.");
+}
+
+Vector<RID> PhysicsServer2D::area_get_overlapping_areas(RID p_area) const {
+	ERR_FAIL_V_MSG(Vector<RID>(), "Area overlap queries are not supported by this physics server.");
+}
+
+TypedArray<RID> PhysicsServer2D::_area_get_overlapping_bodies(RID p_area) const {
+	Vector<RID> bodies = area_get_overlapping_bodies(p_area);
+	TypedArray<RID> ret;
+	ret.resize(bodies.size());
+	for (int i = 0; i < bodies.size(); i++) {
+		ret[i] = bodies[i];
+	}
+	return ret;
+}
+
+TypedArray<RID> PhysicsServer2D::_area_get_overlapping_areas(RID p_area) const {
+	Vector<RID> areas = area_get_overlapping_areas(p_area);
+	TypedArray<RID> ret;
+	ret.resize(areas.size());
+	for (int i = 0; i < areas.size(); i++) {
+		ret[i] = areas[i];
+	}
+	return ret;
+}
+
 void PhysicsServer2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("world_boundary_shape_create"), &PhysicsServer2D::world_boundary_shape_create);
 	ClassDB::bind_method(D_METHOD("separation_ray_shape_create"), &PhysicsServer2D::separation_ray_shape_create);
@@ -671,6 +868,10 @@ void PhysicsServer2D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("area_set_monitor_callback", "area", "callback"), &PhysicsServer2D::area_set_monitor_callback);
 	ClassDB::bind_method(D_METHOD("area_set_area_monitor_callback", "area", "callback"), &PhysicsServer2D::area_set_area_monitor_callback);
+	ClassDB::bind_method(D_METHOD("area_set_monitor_batch_callback", "area", "callback"), &PhysicsServer2D::area_set_monitor_batch_callback);
+	ClassDB::bind_method(D_METHOD("area_set_area_monitor_batch_callback", "area", "callback"), &PhysicsServer2D::area_set_area_monitor_batch_callback);
+	ClassDB::bind_method(D_METHOD("area_get_overlapping_bodies", "area"), &PhysicsServer2D::_area_get_overlapping_bodies);
+	ClassDB::bind_method(D_METHOD("area_get_overlapping_areas", "area"), &PhysicsServer2D::_area_get_overlapping_areas);
 	ClassDB::bind_method(D_METHOD("area_set_monitorable", "area", "monitorable"), &PhysicsServer2D::area_set_monitorable);
 
 	ClassDB::bind_method(D_METHOD("body_create"), &PhysicsServer2D::body_create);
@@ -720,6 +921,8 @@ void PhysicsServer2D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("body_set_state", "body", "state", "value"), &PhysicsServer2D::body_set_state);
 	ClassDB::bind_method(D_METHOD("body_get_state", "body", "state"), &PhysicsServer2D::body_get_state);
+	ClassDB::bind_method(D_METHOD("body_set_states", "bodies", "state", "values"), &PhysicsServer2D::_body_set_states);
+	ClassDB::bind_method(D_METHOD("body_get_states", "bodies", "state"), &PhysicsServer2D::_body_get_states);
 
 	ClassDB::bind_method(D_METHOD("body_apply_central_impulse", "body", "impulse"), &PhysicsServer2D::body_apply_central_impulse);
 	ClassDB::bind_method(D_METHOD("body_apply_torque_impulse", "body", "impulse"), &PhysicsServer2D::body_apply_torque_impulse);
@@ -116,8 +116,10 @@ class PhysicsDirectSpaceState2D : public Object {
 	GDCLASS(PhysicsDirectSpaceState2D, Object);
 
 	Dictionary _intersect_ray(const Ref<PhysicsRayQueryParameters2D> &p_ray_query);
+	Dictionary _intersect_rays(const Ref<PhysicsRayQueryParameters2D> &p_ray_query, const PackedVector2Array &p_from, const PackedVector2Array &p_to);
 	TypedArray<Dictionary> _intersect_point(const Ref<PhysicsPointQueryParameters2D> &p_point_query, int p_max_results = 32);
 	TypedArray<Dictionary> _intersect_shape(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query, int p_max_results = 32);
+	Dictionary _intersect_shapes(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query, const PackedVector2Array &p_positions, int p_max_results = 32);
 	Vector<real_t> _cast_motion(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query);
 	TypedArray<PackedVector2Array> _collide_shape(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query, int p_max_results = 32);
 	Dictionary _get_rest_info(const Ref<PhysicsShapeQueryParameters2D> &p_shape_query);
@@ -149,6 +151,10 @@ public:
 
 	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) = 0;
 
+	// Casts p_count rays from p_from[i] to p_to[i], sharing all other settings of p_parameters.
+	// r_hits[i] tells whether r_results[i] was filled. Implementations may run the rays on several threads.
+	virtual void intersect_rays(const RayParameters &p_parameters, const Vector2 *p_from, const Vector2 *p_to, int p_count, RayResult *r_results, bool *r_hits);
+
 	struct ShapeResult {
 		RID rid;
 		ObjectID collider_id;
@@ -192,6 +198,9 @@ public:
 	};
 
 	virtual int intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) = 0;
+	// Tests the shape of p_parameters at p_count transforms. The results of query i are written to
+	// r_results[i * p_result_max], and their amount to r_result_counts[i].
+	virtual void intersect_shapes(const ShapeParameters &p_parameters, const Transform2D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts);
 	virtual bool cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe) = 0;
 	virtual bool collide_shape(const ShapeParameters &p_parameters, Vector2 *r_results, int p_result_max, int &r_result_count) = 0;
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) = 0;
@@ -344,6 +353,15 @@ public:
 	virtual void area_set_monitor_callback(RID p_area, const Callable &p_callback) = 0;
 	virtual void area_set_area_monitor_callback(RID p_area, const Callable &p_callback) = 0;
 
+	// Batched versions of the monitor callbacks, called at most once per step with all the events of the step.
+	// The default implementations report that batching isn't supported.
+	virtual void area_set_monitor_batch_callback(RID p_area, const Callable &p_callback);
+	virtual void area_set_area_monitor_batch_callback(RID p_area, const Callable &p_callback);
+
+	// Objects overlapping a monitoring area, as of the last events reported.
+	virtual Vector<RID> area_get_overlapping_bodies(RID p_area) const;
+	virtual Vector<RID> area_get_overlapping_areas(RID p_area) const;
+
 	/* BODY API */
 
 	//missing ccd?
@@ -438,6 +456,11 @@ public:
 	virtual void body_set_state(RID p_body, BodyState p_state, const Variant &p_variant) = 0;
 	virtual Variant body_get_state(RID p_body, BodyState p_state) const = 0;
 
+	// Bulk versions, setting or getting the same state on many bodies in a single server call.
+	// The default implementations call body_set_state() and body_get_state() for each body.
+	virtual void body_set_states(const Vector<RID> &p_bodies, BodyState p_state, const Vector<Variant> &p_values);
+	virtual Vector<Variant> body_get_states(const Vector<RID> &p_bodies, BodyState p_state) const;
+
 	virtual void body_apply_central_impulse(RID p_body, const Vector2 &p_impulse) = 0;
 	virtual void body_apply_torque_impulse(RID p_body, real_t p_torque) = 0;
 	virtual void body_apply_impulse(RID p_body, const Vector2 &p_impulse, const Vector2 &p_position = Vector2()) = 0;
@@ -597,6 +620,14 @@ public:
 
 	virtual int get_process_info(ProcessInfo p_info) = 0;
 
+private:
+	// Binder helpers
+	void _body_set_states(const TypedArray<RID> &p_bodies, BodyState p_state, const Array &p_values);
+	Array _body_get_states(const TypedArray<RID> &p_bodies, BodyState p_state) const;
+	TypedArray<RID> _area_get_overlapping_bodies(RID p_area) const;
+	TypedArray<RID> _area_get_overlapping_areas(RID p_area) const;
+
+public:
 	PhysicsServer2D();
 	~PhysicsServer2D();
 };
@@ -168,6 +168,10 @@ public:
 
 	FUNC2(area_set_monitor_callback, RID, const Callable &);
 	FUNC2(area_set_area_monitor_callback, RID, const Callable &);
+	FUNC2(area_set_monitor_batch_callback, RID, const Callable &);
+	FUNC2(area_set_area_monitor_batch_callback, RID, const Callable &);
+	FUNC1RC(Vector<RID>, area_get_overlapping_bodies, RID);
+	FUNC1RC(Vector<RID>, area_get_overlapping_areas, RID);
 
 	/* BODY API */
 
@@ -218,6 +222,8 @@ public:
 
 	FUNC3(body_set_state, RID, BodyState, const Variant &);
 	FUNC2RC(Variant, body_get_state, RID, BodyState);
+	FUNC3(body_set_states, const Vector<RID> &, BodyState, const Vector<Variant> &);
+	FUNC2RC(Vector<Variant>, body_get_states, const Vector<RID> &, BodyState);
 
 	FUNC2(body_apply_torque_impulse, RID, const Vector3 &);
 	FUNC2(body_apply_central_impulse, RID, const Vector3 &);
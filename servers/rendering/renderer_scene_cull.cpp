@@ -892,6 +892,29 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 	_instance_queue_update(instance, true);
 }
 
+void RendererSceneCull::instance_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+
+	const RID *instances = p_instances.ptr();
+	const Transform3D *transforms = p_transforms.ptr();
+	for (int i = 0; i < p_instances.size(); i++) {
+		Instance *instance = instance_owner.get_or_null(instances[i]);
+		ERR_CONTINUE(!instance);
+
+		const Transform3D &transform = transforms[i];
+		if (instance->transform == transform) {
+			continue;
+		}
+
+#ifdef DEBUG_ENABLED
+		ERR_CONTINUE(!transform.basis.rows[0].is_finite() || !transform.basis.rows[1].is_finite() || !transform.basis.rows[2].is_finite() || !transform.origin.is_finite());
+#endif
+
+		instance->transform = transform;
+		_instance_queue_update(instance, true);
+	}
+}
+
 void RendererSceneCull::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_COND(!instance);
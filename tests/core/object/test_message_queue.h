@@ -0,0 +1,147 @@
+/*************************************************************************/
+/*  test_message_queue.h                                                 */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_MESSAGE_QUEUE_H
+#define TEST_MESSAGE_QUEUE_H
+
+#include "core/object/message_queue.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/templates/safe_refcount.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMessageQueue {
+
+class DeferredCallCounter : public Object {
+public:
+	int calls = 0;
+
+	void increment() {
+		calls++;
+	}
+};
+
+struct DeferredCallPusher {
+	DeferredCallCounter *counter = nullptr;
+	int call_count = 0;
+	SafeNumeric<int> *finished = nullptr;
+
+	static void push_calls(void *p_userdata) {
+		DeferredCallPusher *pusher = static_cast<DeferredCallPusher *>(p_userdata);
+		for (int i = 0; i < pusher->call_count; i++) {
+			MessageQueue::get_singleton()->push_callable(callable_mp(pusher->counter, &DeferredCallCounter::increment));
+		}
+		pusher->finished->increment();
+		// The thread exits right away, its queue must still be flushed.
+	}
+};
+
+TEST_CASE("[MessageQueue] Calls deferred from threads that exit are all delivered") {
+	MessageQueue *queue = memnew(MessageQueue);
+	DeferredCallCounter counter;
+
+	const int thread_count = 8;
+	const int rounds = 20;
+	const int call_count = 50;
+	for (int round = 0; round < rounds; round++) {
+		DeferredCallPusher pushers[thread_count];
+		Thread threads[thread_count];
+		SafeNumeric<int> finished;
+		for (int i = 0; i < thread_count; i++) {
+			pushers[i].counter = &counter;
+			pushers[i].finished = &finished;
+			pushers[i].call_count = call_count;
+			threads[i].start(&DeferredCallPusher::push_calls, &pushers[i]);
+		}
+
+		// Flushing while the threads push and exit.
+		while (finished.get() < thread_count) {
+			queue->flush();
+		}
+
+		for (int i = 0; i < thread_count; i++) {
+			threads[i].wait_to_finish();
+		}
+		queue->flush();
+
+		CHECK_MESSAGE(counter.calls == (round + 1) * thread_count * call_count, vformat("Deferred calls were lost in round %d.", round));
+	}
+
+	memdelete(queue);
+}
+
+struct PersistentDeferredCallPusher {
+	DeferredCallCounter *counter = nullptr;
+	int call_count = 0;
+	bool exit = false;
+	Semaphore start;
+	Semaphore done;
+
+	static void run(void *p_userdata) {
+		PersistentDeferredCallPusher *pusher = static_cast<PersistentDeferredCallPusher *>(p_userdata);
+		while (true) {
+			pusher->start.wait();
+			if (pusher->exit) {
+				break;
+			}
+			for (int i = 0; i < pusher->call_count; i++) {
+				MessageQueue::get_singleton()->push_callable(callable_mp(pusher->counter, &DeferredCallCounter::increment));
+			}
+			pusher->done.post();
+		}
+	}
+};
+
+TEST_CASE("[MessageQueue] Calls deferred from a thread that outlives a message queue are delivered by the next one") {
+	DeferredCallCounter counter;
+	PersistentDeferredCallPusher pusher;
+	pusher.counter = &counter;
+	pusher.call_count = 50;
+	Thread thread;
+	thread.start(&PersistentDeferredCallPusher::run, &pusher);
+
+	for (int round = 0; round < 3; round++) {
+		MessageQueue *queue = memnew(MessageQueue);
+		pusher.start.post();
+		pusher.done.wait();
+		queue->flush();
+		CHECK_MESSAGE(counter.calls == (round + 1) * pusher.call_count, vformat("Deferred calls were lost with message queue %d.", round));
+		memdelete(queue);
+	}
+
+	pusher.exit = true;
+	pusher.start.post();
+	thread.wait_to_finish();
+}
+
+} // namespace TestMessageQueue
+
+#endif // TEST_MESSAGE_QUEUE_H
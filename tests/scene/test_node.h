@@ -0,0 +1,416 @@
+/*************************************************************************/
+/*  test_node.h                                                          */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_NODE_H
+#define TEST_NODE_H
+
+#include "scene/main/node.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+// Declared in global namespace because of GDCLASS macro warning (Windows):
+// "Unqualified friend declaration referring to type outside of the nearest enclosing namespace
+// is a Microsoft extension; add a nested name specifier".
+class _TestUnparentedLookupNode : public Node {
+	GDCLASS(_TestUnparentedLookupNode, Node);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_UNPARENTED && lookup_from) {
+			found = lookup_from->get_node_or_null(lookup_path);
+		}
+	}
+
+public:
+	Node *lookup_from = nullptr;
+	NodePath lookup_path;
+	Node *found = nullptr;
+};
+
+namespace TestNode {
+
+TEST_CASE("[SceneTree][Node] Child lookup by name with many children") {
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	const int child_count = 200;
+	for (int i = 0; i < child_count; i++) {
+		Node *child = memnew(Node);
+		child->set_name("Child" + itos(i));
+		parent->add_child(child);
+	}
+
+	CHECK(parent->get_node_or_null(NodePath("Child0")) == parent->get_child(0));
+	CHECK(parent->get_node_or_null(NodePath("Child199")) == parent->get_child(199));
+	CHECK(parent->get_node_or_null(NodePath("Child200")) == nullptr);
+
+	SUBCASE("Renamed children are found under their new name only") {
+		Node *child = parent->get_child(10);
+		child->set_name("Renamed");
+		CHECK(parent->get_node_or_null(NodePath("Renamed")) == child);
+		CHECK(parent->get_node_or_null(NodePath("Child10")) == nullptr);
+	}
+
+	SUBCASE("Clashing names are still made unique") {
+		Node *child = memnew(Node);
+		child->set_name("Child5");
+		parent->add_child(child, true);
+		CHECK(child->get_name() != StringName("Child5"));
+		CHECK(parent->get_node_or_null(NodePath(child->get_name())) == child);
+		CHECK(parent->get_node_or_null(NodePath("Child5")) == parent->get_child(5));
+	}
+
+	SUBCASE("Removed children are no longer found") {
+		Node *child = parent->get_child(20);
+		parent->remove_child(child);
+		CHECK(parent->get_node_or_null(NodePath("Child20")) == nullptr);
+		memdelete(child);
+	}
+
+	SUBCASE("Cached paths follow tree changes") {
+		Node *child = parent->get_child(30);
+		Node *grandchild = memnew(Node);
+		grandchild->set_name("Grandchild");
+		child->add_child(grandchild);
+
+		NodePath path("Child30/Grandchild");
+		CHECK(parent->get_node_or_null(path) == grandchild);
+		CHECK(parent->get_node_or_null(path) == grandchild);
+
+		child->remove_child(grandchild);
+		CHECK(parent->get_node_or_null(path) == nullptr);
+
+		Node *other = parent->get_child(31);
+		other->set_name("Child30b");
+		child->set_name("Child30c");
+		other->set_name("Child30");
+		other->add_child(grandchild);
+		CHECK(parent->get_node_or_null(path) == grandchild);
+	}
+
+	SUBCASE("Paths cached while a child is being removed are dropped") {
+		_TestUnparentedLookupNode *child = memnew(_TestUnparentedLookupNode);
+		child->set_name("Leaving");
+		child->lookup_from = parent;
+		child->lookup_path = NodePath("Leaving");
+		parent->add_child(child);
+
+		parent->remove_child(child);
+		CHECK(child->found == child); // Still listed when unparented.
+		CHECK(parent->get_node_or_null(NodePath("Leaving")) == nullptr);
+
+		child->found = nullptr;
+		parent->add_child(child);
+		Vector<Node *> to_remove;
+		to_remove.push_back(child);
+		parent->remove_children(to_remove);
+		CHECK(child->found == child);
+		CHECK(parent->get_node_or_null(NodePath("Leaving")) == nullptr);
+
+		memdelete(child);
+	}
+
+	SUBCASE("Lookups and misses are counted") {
+		uint64_t calls = Node::get_node_call_count.get();
+		uint64_t misses = Node::get_node_miss_count.get();
+		parent->get_node_or_null(NodePath("Child1"));
+		parent->get_node_or_null(NodePath("Missing"));
+		CHECK(Node::get_node_call_count.get() == calls + 2);
+		CHECK(Node::get_node_miss_count.get() == misses + 1);
+	}
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node] Adding and removing children in batches") {
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	Vector<Node *> children;
+	for (int i = 0; i < 100; i++) {
+		Node *child = memnew(Node);
+		child->set_name("Child" + itos(i % 50)); // Every name is used twice.
+		children.push_back(child);
+	}
+	parent->add_children(children);
+
+	REQUIRE(parent->get_child_count() == 100);
+	for (int i = 0; i < 100; i++) {
+		CHECK(parent->get_child(i) == children[i]);
+		CHECK(children[i]->get_index() == i);
+		CHECK(children[i]->is_inside_tree());
+		CHECK(parent->get_node_or_null(NodePath(children[i]->get_name())) == children[i]);
+	}
+	CHECK(children[0]->get_name() == StringName("Child0"));
+	CHECK(children[50]->get_name() != StringName("Child0"));
+
+	Vector<Node *> to_remove;
+	for (int i = 0; i < 100; i += 2) {
+		to_remove.push_back(children[i]);
+	}
+	parent->remove_children(to_remove);
+
+	REQUIRE(parent->get_child_count() == 50);
+	for (int i = 0; i < 50; i++) {
+		CHECK(parent->get_child(i) == children[i * 2 + 1]);
+		CHECK(children[i * 2 + 1]->get_index() == i);
+	}
+	for (int i = 0; i < to_remove.size(); i++) {
+		CHECK(to_remove[i]->get_parent() == nullptr);
+		CHECK_FALSE(to_remove[i]->is_inside_tree());
+		memdelete(to_remove[i]);
+	}
+
+	parent->queue_free_children();
+	CHECK(parent->get_child_count() == 50);
+	SceneTree::get_singleton()->process(0);
+	CHECK(parent->get_child_count() == 0);
+
+	memdelete(parent);
+}
+
+class BatchSiblingHandler : public Object {
+public:
+	Node *parent = nullptr;
+	Node *adopter = nullptr;
+	Node *target = nullptr;
+
+	void remove_target(Node *p_child) {
+		if (target->get_parent() == parent) {
+			parent->remove_child(target);
+		}
+	}
+
+	void adopt_target() {
+		if (!target->get_parent()) {
+			adopter->add_child(target);
+		}
+	}
+};
+
+TEST_CASE("[SceneTree][Node] Batches with callbacks changing siblings") {
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	SUBCASE("Sibling removed while the batch is added") {
+		Vector<Node *> children;
+		for (int i = 0; i < 3; i++) {
+			children.push_back(memnew(Node));
+		}
+
+		BatchSiblingHandler handler;
+		handler.parent = parent;
+		handler.target = children[2];
+		parent->connect("child_entered_tree", callable_mp(&handler, &BatchSiblingHandler::remove_target));
+
+		parent->add_children(children);
+
+		REQUIRE(parent->get_child_count() == 2);
+		CHECK(parent->get_child(0) == children[0]);
+		CHECK(parent->get_child(1) == children[1]);
+		CHECK(children[1]->is_inside_tree());
+		CHECK(children[2]->get_parent() == nullptr);
+		CHECK_FALSE(children[2]->is_inside_tree());
+		memdelete(children[2]);
+	}
+
+	SUBCASE("Sibling reparented while the batch is freed") {
+		Node *first = memnew(Node);
+		Node *second = memnew(Node);
+		parent->add_child(first);
+		parent->add_child(second);
+		ObjectID second_id = second->get_instance_id();
+
+		// Deleting the first child also deletes the second one, which must not be deleted again.
+		BatchSiblingHandler handler;
+		handler.adopter = first;
+		handler.target = second;
+		first->connect("tree_exited", callable_mp(&handler, &BatchSiblingHandler::adopt_target));
+
+		parent->queue_free_children();
+		SceneTree::get_singleton()->process(0);
+
+		CHECK(parent->get_child_count() == 0);
+		CHECK(ObjectDB::get_instance(second_id) == nullptr);
+	}
+
+	SUBCASE("Internal children removed together") {
+		Node *front_a = memnew(Node);
+		Node *front_b = memnew(Node);
+		Node *back_a = memnew(Node);
+		Node *back_b = memnew(Node);
+		parent->add_child(front_a, false, Node::INTERNAL_MODE_FRONT);
+		parent->add_child(front_b, false, Node::INTERNAL_MODE_FRONT);
+		parent->add_child(back_a, false, Node::INTERNAL_MODE_BACK);
+		parent->add_child(back_b, false, Node::INTERNAL_MODE_BACK);
+		Node *child = memnew(Node);
+		parent->add_child(child);
+
+		Vector<Node *> to_remove;
+		to_remove.push_back(front_a);
+		to_remove.push_back(front_b);
+		to_remove.push_back(back_b);
+		to_remove.push_back(back_a);
+		parent->remove_children(to_remove);
+
+		CHECK(parent->get_child_count(true) == 1);
+		CHECK(parent->get_child_count(false) == 1);
+		CHECK(parent->get_child(0, false) == child);
+		CHECK(child->get_index(false) == 0);
+
+		for (int i = 0; i < to_remove.size(); i++) {
+			memdelete(to_remove[i]);
+		}
+	}
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node] Groups stay in tree order") {
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	Vector<Node *> nodes;
+	for (int i = 0; i < 10; i++) {
+		Node *child = memnew(Node);
+		child->add_to_group("ordered");
+		parent->add_child(child);
+		nodes.push_back(child);
+	}
+	REQUIRE(SceneTree::get_singleton()->get_node_count_in_group("ordered") == 10);
+
+	// Added in the middle of the group, and removed again.
+	Node *front = memnew(Node);
+	front->add_to_group("ordered");
+	parent->add_child(front);
+	parent->move_child(front, 0);
+	nodes[4]->remove_from_group("ordered");
+	parent->remove_child(nodes[7]);
+
+	Vector<Node *> group = SceneTree::get_singleton()->get_group_nodes("ordered");
+	REQUIRE(group.size() == 9);
+	CHECK(group[0] == front);
+	for (int i = 1; i < group.size(); i++) {
+		CHECK(group[i]->is_greater_than(group[i - 1]));
+	}
+
+	Node *late = memnew(Node);
+	parent->add_child(late);
+	parent->move_child(late, 3);
+	late->add_to_group("ordered");
+	group = SceneTree::get_singleton()->get_group_nodes("ordered");
+	REQUIRE(group.size() == 10);
+	for (int i = 1; i < group.size(); i++) {
+		CHECK(group[i]->is_greater_than(group[i - 1]));
+	}
+
+	memdelete(nodes[7]);
+	memdelete(parent);
+	CHECK(SceneTree::get_singleton()->get_node_count_in_group("ordered") == 0);
+}
+
+class TimeSlicedJobCounter : public Object {
+public:
+	int runs = 0;
+	int run_limit = -1;
+	LocalVector<int> *log = nullptr;
+	int tag = 0;
+
+	bool run() {
+		runs++;
+		if (log) {
+			log->push_back(tag);
+		}
+		return run_limit < 0 || runs < run_limit;
+	}
+};
+
+TEST_CASE("[SceneTree] Time-sliced jobs") {
+	SceneTree *tree = SceneTree::get_singleton();
+	const double previous_budget = tree->get_time_slice_budget();
+	// Only the first eligible job runs each frame.
+	tree->set_time_slice_budget(0);
+
+	LocalVector<int> log;
+	TimeSlicedJobCounter jobs[3];
+	for (int i = 0; i < 3; i++) {
+		jobs[i].log = &log;
+		jobs[i].tag = i;
+	}
+	tree->add_time_sliced_job(callable_mp(&jobs[0], &TimeSlicedJobCounter::run), 1);
+	tree->add_time_sliced_job(callable_mp(&jobs[1], &TimeSlicedJobCounter::run), 1);
+	tree->add_time_sliced_job(callable_mp(&jobs[2], &TimeSlicedJobCounter::run), 0);
+	CHECK(tree->get_time_sliced_job_count() == 3);
+	CHECK(tree->has_time_sliced_job(callable_mp(&jobs[1], &TimeSlicedJobCounter::run)));
+
+	SUBCASE("Lower priorities run first") {
+		for (int i = 0; i < 3; i++) {
+			tree->process(0);
+		}
+		REQUIRE(log.size() == 3);
+		CHECK(log[0] == 2);
+		CHECK(log[1] == 2);
+		CHECK(log[2] == 2);
+	}
+
+	SUBCASE("Jobs of the same priority take turns, and finished jobs are removed") {
+		jobs[2].run_limit = 1;
+		for (int i = 0; i < 5; i++) {
+			tree->process(0);
+		}
+		REQUIRE(log.size() == 5);
+		CHECK(log[0] == 2);
+		CHECK(log[1] == 0);
+		CHECK(log[2] == 1);
+		CHECK(log[3] == 0);
+		CHECK(log[4] == 1);
+		CHECK(tree->get_time_sliced_job_count() == 2);
+		CHECK_FALSE(tree->has_time_sliced_job(callable_mp(&jobs[2], &TimeSlicedJobCounter::run)));
+	}
+
+	SUBCASE("A large budget runs every job in the same frame") {
+		tree->set_time_slice_budget(1000000);
+		tree->process(0);
+		CHECK(jobs[0].runs == 1);
+		CHECK(jobs[1].runs == 1);
+		CHECK(jobs[2].runs == 1);
+	}
+
+	for (int i = 0; i < 3; i++) {
+		tree->remove_time_sliced_job(callable_mp(&jobs[i], &TimeSlicedJobCounter::run));
+	}
+	CHECK(tree->get_time_sliced_job_count() == 0);
+	tree->set_time_slice_budget(previous_budget);
+}
+
+} // namespace TestNode
+
+#endif // TEST_NODE_H
@@ -0,0 +1,121 @@
+/*************************************************************************/
+/*  test_node_3d.h                                                       */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_NODE_3D_H
+#define TEST_NODE_3D_H
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+// Declared in global namespace because of GDCLASS macro warning (Windows):
+// "Unqualified friend declaration referring to type outside of the nearest enclosing namespace
+// is a Microsoft extension; add a nested name specifier".
+class _TestTransformNotifiedNode3D : public Node3D {
+	GDCLASS(_TestTransformNotifiedNode3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			transform_changed_count++;
+		}
+	}
+
+public:
+	int transform_changed_count = 0;
+};
+
+namespace TestNode3D {
+
+TEST_CASE("[SceneTree][Node3D] Global transform propagation") {
+	Node3D *root = memnew(Node3D);
+	Node3D *child = memnew(Node3D);
+	Node3D *grandchild = memnew(Node3D);
+	root->add_child(child);
+	child->add_child(grandchild);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+
+	child->set_position(Vector3(1, 0, 0));
+	grandchild->set_position(Vector3(0, 1, 0));
+	CHECK(grandchild->get_global_transform().origin.is_equal_approx(Vector3(1, 1, 0)));
+
+	SUBCASE("Repeated changes without reading the global transform in between") {
+		root->set_position(Vector3(0, 0, 1));
+		root->set_position(Vector3(0, 0, 2));
+		child->set_position(Vector3(2, 0, 0));
+		CHECK(grandchild->get_global_transform().origin.is_equal_approx(Vector3(2, 1, 2)));
+		CHECK(child->get_global_transform().origin.is_equal_approx(Vector3(2, 0, 2)));
+	}
+
+	SUBCASE("Changes after a partial read") {
+		root->set_position(Vector3(0, 0, 1));
+		CHECK(child->get_global_transform().origin.is_equal_approx(Vector3(1, 0, 1)));
+		root->set_position(Vector3(0, 0, 3));
+		CHECK(grandchild->get_global_transform().origin.is_equal_approx(Vector3(1, 1, 3)));
+	}
+
+	SUBCASE("Top level nodes are not affected by their parent") {
+		grandchild->set_as_top_level(true);
+		root->set_position(Vector3(5, 0, 0));
+		CHECK(grandchild->get_global_transform().origin.is_equal_approx(Vector3(1, 1, 0)));
+		CHECK(child->get_global_transform().origin.is_equal_approx(Vector3(6, 0, 0)));
+	}
+
+	SUBCASE("Nodes requesting transform notifications") {
+		_TestTransformNotifiedNode3D *notified = memnew(_TestTransformNotifiedNode3D);
+		notified->set_position(Vector3(0, 0, 1));
+		grandchild->add_child(notified);
+		notified->set_notify_transform(true);
+		SceneTree::get_singleton()->flush_transform_notifications();
+		notified->transform_changed_count = 0;
+
+		// Repeated changes within a frame are notified once.
+		root->set_position(Vector3(0, 0, 1));
+		root->set_position(Vector3(0, 0, 2));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(notified->transform_changed_count == 1);
+
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(notified->transform_changed_count == 1);
+
+		// Changes after a flush reach the node again, even if nothing read its transform since.
+		root->set_position(Vector3(0, 0, 3));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(notified->transform_changed_count == 2);
+		CHECK(notified->get_global_transform().origin.is_equal_approx(Vector3(1, 1, 4)));
+	}
+
+	memdelete(root);
+}
+
+} // namespace TestNode3D
+
+#endif // TEST_NODE_3D_H
@@ -0,0 +1,193 @@
+/*************************************************************************/
+/*  test_physics_area_monitor.h                                          */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PHYSICS_AREA_MONITOR_H
+#define TEST_PHYSICS_AREA_MONITOR_H
+
+#include "servers/physics_server_3d.h"
+#include "tests/test_macros.h"
+
+namespace TestPhysicsAreaMonitor {
+
+class AreaMonitorRecorder : public Object {
+public:
+	int single_calls = 0;
+	int batch_calls = 0;
+	LocalVector<int> statuses;
+	LocalVector<RID> rids;
+	LocalVector<int> single_statuses;
+
+	void on_event(int p_status, RID p_rid, ObjectID p_instance_id, int p_object_shape, int p_area_shape) {
+		single_calls++;
+		single_statuses.push_back(p_status);
+	}
+
+	void on_batch(const PackedInt32Array &p_statuses, const Array &p_rids, const PackedInt64Array &p_instance_ids, const PackedInt32Array &p_object_shapes, const PackedInt32Array &p_area_shapes) {
+		batch_calls++;
+		CHECK(p_rids.size() == p_statuses.size());
+		CHECK(p_instance_ids.size() == p_statuses.size());
+		CHECK(p_object_shapes.size() == p_statuses.size());
+		CHECK(p_area_shapes.size() == p_statuses.size());
+		for (int i = 0; i < p_statuses.size(); i++) {
+			statuses.push_back(p_statuses[i]);
+			rids.push_back(p_rids[i]);
+		}
+	}
+};
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Area monitor events are batched once per step") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	RID area = ps->area_create();
+	ps->area_set_space(area, space);
+	ps->area_add_shape(area, box_shape);
+
+	AreaMonitorRecorder recorder;
+	ps->area_set_monitor_callback(area, callable_mp(&recorder, &AreaMonitorRecorder::on_event));
+	ps->area_set_monitor_batch_callback(area, callable_mp(&recorder, &AreaMonitorRecorder::on_batch));
+
+	// Several bodies entering during the same step.
+	const int body_count = 4;
+	RID bodies[body_count];
+	for (int i = 0; i < body_count; i++) {
+		bodies[i] = ps->body_create();
+		ps->body_set_space(bodies[i], space);
+		ps->body_add_shape(bodies[i], box_shape);
+		ps->body_set_param(bodies[i], PhysicsServer3D::BODY_PARAM_GRAVITY_SCALE, 0.0);
+		ps->body_set_state(bodies[i], PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0.1 * i, 0, 0)));
+	}
+
+	ps->step(1.0 / 60.0);
+	ps->flush_queries();
+
+	CHECK(recorder.batch_calls == 1);
+	CHECK(recorder.single_calls == body_count);
+	REQUIRE(recorder.statuses.size() == body_count);
+	for (int i = 0; i < body_count; i++) {
+		CHECK(recorder.statuses[i] == PhysicsServer3D::AREA_BODY_ADDED);
+	}
+	CHECK(ps->area_get_overlapping_bodies(area).size() == body_count);
+
+	// Steps without any change don't call the batch callback.
+	ps->step(1.0 / 60.0);
+	ps->flush_queries();
+	CHECK(recorder.batch_calls == 1);
+
+	// A body leaving is reported and no longer listed as overlapping.
+	ps->body_set_state(bodies[0], PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, 10, 0)));
+	ps->step(1.0 / 60.0);
+	ps->flush_queries();
+
+	CHECK(recorder.batch_calls == 2);
+	REQUIRE(recorder.statuses.size() == body_count + 1);
+	CHECK(recorder.statuses[body_count] == PhysicsServer3D::AREA_BODY_REMOVED);
+	CHECK(recorder.rids[body_count] == bodies[0]);
+	Vector<RID> overlapping = ps->area_get_overlapping_bodies(area);
+	CHECK(overlapping.size() == body_count - 1);
+	CHECK_FALSE(overlapping.has(bodies[0]));
+
+	for (int i = 0; i < body_count; i++) {
+		ps->free(bodies[i]);
+	}
+	ps->free(area);
+	ps->free(box_shape);
+	ps->free(space);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Setting a batch callback keeps the overlaps already reported") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	RID area = ps->area_create();
+	ps->area_set_space(area, space);
+	ps->area_add_shape(area, box_shape);
+
+	AreaMonitorRecorder recorder;
+	ps->area_set_monitor_callback(area, callable_mp(&recorder, &AreaMonitorRecorder::on_event));
+
+	const int body_count = 2;
+	RID bodies[body_count];
+	for (int i = 0; i < body_count; i++) {
+		bodies[i] = ps->body_create();
+		ps->body_set_space(bodies[i], space);
+		ps->body_add_shape(bodies[i], box_shape);
+		ps->body_set_param(bodies[i], PhysicsServer3D::BODY_PARAM_GRAVITY_SCALE, 0.0);
+		ps->body_set_state(bodies[i], PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0.1 * i, 0, 0)));
+	}
+
+	ps->step(1.0 / 60.0);
+	ps->flush_queries();
+	CHECK(recorder.single_calls == body_count);
+
+	// The bodies already overlap, so they must not be reported as added again.
+	ps->area_set_monitor_batch_callback(area, callable_mp(&recorder, &AreaMonitorRecorder::on_batch));
+	for (int i = 0; i < 2; i++) {
+		ps->step(1.0 / 60.0);
+		ps->flush_queries();
+	}
+	CHECK(recorder.single_calls == body_count);
+	CHECK(recorder.batch_calls == 0);
+	CHECK(ps->area_get_overlapping_bodies(area).size() == body_count);
+
+	// Both callbacks report the body leaving.
+	ps->body_set_state(bodies[0], PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, 10, 0)));
+	ps->step(1.0 / 60.0);
+	ps->flush_queries();
+
+	REQUIRE(recorder.single_statuses.size() == body_count + 1);
+	CHECK(recorder.single_statuses[body_count] == PhysicsServer3D::AREA_BODY_REMOVED);
+	CHECK(recorder.batch_calls == 1);
+	REQUIRE(recorder.statuses.size() == 1);
+	CHECK(recorder.statuses[0] == PhysicsServer3D::AREA_BODY_REMOVED);
+	CHECK(recorder.rids[0] == bodies[0]);
+	CHECK(ps->area_get_overlapping_bodies(area).size() == body_count - 1);
+
+	for (int i = 0; i < body_count; i++) {
+		ps->free(bodies[i]);
+	}
+	ps->free(area);
+	ps->free(box_shape);
+	ps->free(space);
+}
+
+} // namespace TestPhysicsAreaMonitor
+
+#endif // TEST_PHYSICS_AREA_MONITOR_H
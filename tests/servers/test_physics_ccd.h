@@ -0,0 +1,109 @@
+/*************************************************************************/
+/*  test_physics_ccd.h                                                   */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PHYSICS_CCD_H
+#define TEST_PHYSICS_CCD_H
+
+#include "servers/physics_server_3d.h"
+#include "tests/test_macros.h"
+
+namespace TestPhysicsCCD {
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Fast bodies with CCD don't tunnel through thin walls") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+
+	const real_t wall_x = 10.0;
+
+	RID box_wall_shape = ps->box_shape_create();
+	ps->shape_set_data(box_wall_shape, Vector3(0.025, 5, 5));
+
+	RID concave_wall_shape = ps->concave_polygon_shape_create();
+	PackedVector3Array faces;
+	faces.push_back(Vector3(0, -5, -5));
+	faces.push_back(Vector3(0, 5, -5));
+	faces.push_back(Vector3(0, -5, 5));
+	faces.push_back(Vector3(0, 5, -5));
+	faces.push_back(Vector3(0, 5, 5));
+	faces.push_back(Vector3(0, -5, 5));
+	Dictionary concave_data;
+	concave_data["faces"] = faces;
+	concave_data["backface_collision"] = true;
+	ps->shape_set_data(concave_wall_shape, concave_data);
+
+	RID projectile_shape = ps->sphere_shape_create();
+	ps->shape_set_data(projectile_shape, 0.1);
+
+	RID wall_shapes[2] = { box_wall_shape, concave_wall_shape };
+	for (int s = 0; s < 2; s++) {
+		RID space = ps->space_create();
+		ps->space_set_active(space, true);
+
+		RID wall = ps->body_create();
+		ps->body_set_mode(wall, PhysicsServer3D::BODY_MODE_STATIC);
+		ps->body_set_space(wall, space);
+		ps->body_add_shape(wall, wall_shapes[s]);
+		ps->body_set_state(wall, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(wall_x, 0, 0)));
+
+		// Each projectile moves several times its own size per step, and much more than the wall thickness.
+		const int projectile_count = 16;
+		RID projectiles[projectile_count];
+		for (int i = 0; i < projectile_count; i++) {
+			projectiles[i] = ps->body_create();
+			ps->body_set_space(projectiles[i], space);
+			ps->body_add_shape(projectiles[i], projectile_shape);
+			ps->body_set_enable_continuous_collision_detection(projectiles[i], true);
+			ps->body_set_state(projectiles[i], PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(i * 0.37, (i % 4) - 1.5, (i / 4) - 1.5)));
+			ps->body_set_state(projectiles[i], PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(200 + i * 13, 0, 0));
+		}
+
+		for (int i = 0; i < 30; i++) {
+			ps->step(1.0 / 60.0);
+		}
+
+		for (int i = 0; i < projectile_count; i++) {
+			Transform3D xform = ps->body_get_state(projectiles[i], PhysicsServer3D::BODY_STATE_TRANSFORM);
+			CHECK_MESSAGE(xform.origin.x < wall_x, vformat("Projectile %d went through the wall.", i));
+		}
+
+		for (int i = 0; i < projectile_count; i++) {
+			ps->free(projectiles[i]);
+		}
+		ps->free(wall);
+		ps->free(space);
+	}
+
+	ps->free(projectile_shape);
+	ps->free(concave_wall_shape);
+	ps->free(box_wall_shape);
+}
+
+} // namespace TestPhysicsCCD
+
+#endif // TEST_PHYSICS_CCD_H
@@ -0,0 +1,215 @@
+/*************************************************************************/
+/*  test_physics_determinism.h                                           */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PHYSICS_DETERMINISM_H
+#define TEST_PHYSICS_DETERMINISM_H
+
+#include "core/config/project_settings.h"
+#include "servers/physics_server_2d.h"
+#include "servers/physics_server_3d.h"
+#include "tests/test_macros.h"
+
+namespace TestPhysicsDeterminism {
+
+// Number of boxes dropped on the floor, and how many steps they are simulated for.
+const int BODY_COUNT = 24;
+const int STEP_COUNT = 90;
+
+// Drops a pile of boxes on a floor and returns their final transforms and velocities.
+// When p_shuffle_memory is true, throwaway objects are created in between the real
+// ones, so the bodies end up at different addresses and with different RIDs, while
+// keeping the same relative creation order.
+static Vector<Variant> simulate_3d(bool p_shuffle_memory) {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	Vector<RID> garbage;
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	RID floor_shape = ps->world_boundary_shape_create();
+	ps->shape_set_data(floor_shape, Plane(Vector3(0, 1, 0), 0));
+	RID floor = ps->body_create();
+	ps->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	ps->body_set_space(floor, space);
+	ps->body_add_shape(floor, floor_shape);
+
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	Vector<RID> bodies;
+	for (int i = 0; i < BODY_COUNT; i++) {
+		if (p_shuffle_memory) {
+			garbage.push_back(ps->body_create());
+			garbage.push_back(ps->sphere_shape_create());
+		}
+
+		RID body = ps->body_create();
+		ps->body_set_space(body, space);
+		ps->body_add_shape(body, box_shape);
+		Transform3D xform(Basis(Vector3(0, 1, 0), i * 0.3), Vector3((i % 3) * 0.9, 0.6 + (i / 3) * 1.1, (i % 2) * 0.4));
+		ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, xform);
+		ps->body_set_state(body, PhysicsServer3D::BODY_STATE_ANGULAR_VELOCITY, Vector3(0.1 * i, 0.0, -0.05 * i));
+		bodies.push_back(body);
+	}
+
+	for (int i = 0; i < garbage.size(); i += 3) {
+		// Freeing some of them leaves holes in the allocators.
+		ps->free(garbage[i]);
+	}
+
+	for (int i = 0; i < STEP_COUNT; i++) {
+		ps->step(1.0 / 60.0);
+	}
+
+	Vector<Variant> result;
+	for (int i = 0; i < bodies.size(); i++) {
+		result.push_back(ps->body_get_state(bodies[i], PhysicsServer3D::BODY_STATE_TRANSFORM));
+		result.push_back(ps->body_get_state(bodies[i], PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY));
+		result.push_back(ps->body_get_state(bodies[i], PhysicsServer3D::BODY_STATE_ANGULAR_VELOCITY));
+		ps->free(bodies[i]);
+	}
+	for (int i = 0; i < garbage.size(); i++) {
+		if (i % 3 != 0) {
+			ps->free(garbage[i]);
+		}
+	}
+	ps->free(floor);
+	ps->free(box_shape);
+	ps->free(floor_shape);
+	ps->free(space);
+
+	return result;
+}
+
+static Vector<Variant> simulate_2d(bool p_shuffle_memory) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	Vector<RID> garbage;
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	RID floor_shape = ps->world_boundary_shape_create();
+	Array floor_data;
+	floor_data.push_back(Vector2(0, 1));
+	floor_data.push_back(0.0);
+	ps->shape_set_data(floor_shape, floor_data);
+	RID floor = ps->body_create();
+	ps->body_set_mode(floor, PhysicsServer2D::BODY_MODE_STATIC);
+	ps->body_set_space(floor, space);
+	ps->body_add_shape(floor, floor_shape);
+
+	RID box_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(box_shape, Vector2(16, 16));
+
+	Vector<RID> bodies;
+	for (int i = 0; i < BODY_COUNT; i++) {
+		if (p_shuffle_memory) {
+			garbage.push_back(ps->body_create());
+			garbage.push_back(ps->circle_shape_create());
+		}
+
+		RID body = ps->body_create();
+		ps->body_set_space(body, space);
+		ps->body_add_shape(body, box_shape);
+		Transform2D xform(i * 0.3, Vector2((i % 3) * 30.0, 20.0 + (i / 3) * 34.0));
+		ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, xform);
+		ps->body_set_state(body, PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY, Vector2(0, -200));
+		ps->body_set_state(body, PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY, 0.1 * i);
+		bodies.push_back(body);
+	}
+
+	for (int i = 0; i < garbage.size(); i += 3) {
+		ps->free(garbage[i]);
+	}
+
+	for (int i = 0; i < STEP_COUNT; i++) {
+		ps->step(1.0 / 60.0);
+	}
+
+	Vector<Variant> result;
+	for (int i = 0; i < bodies.size(); i++) {
+		result.push_back(ps->body_get_state(bodies[i], PhysicsServer2D::BODY_STATE_TRANSFORM));
+		result.push_back(ps->body_get_state(bodies[i], PhysicsServer2D::BODY_STATE_LINEAR_VELOCITY));
+		result.push_back(ps->body_get_state(bodies[i], PhysicsServer2D::BODY_STATE_ANGULAR_VELOCITY));
+		ps->free(bodies[i]);
+	}
+	for (int i = 0; i < garbage.size(); i++) {
+		if (i % 3 != 0) {
+			ps->free(garbage[i]);
+		}
+	}
+	ps->free(floor);
+	ps->free(box_shape);
+	ps->free(floor_shape);
+	ps->free(space);
+
+	return result;
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Deterministic step produces bit-identical results") {
+	ProjectSettings::get_singleton()->set_setting("physics/3d/solver/deterministic", true);
+
+	Vector<Variant> first = simulate_3d(false);
+	Vector<Variant> second = simulate_3d(true);
+	Vector<Variant> third = simulate_3d(false);
+
+	ProjectSettings::get_singleton()->set_setting("physics/3d/solver/deterministic", false);
+
+	REQUIRE(first.size() == BODY_COUNT * 3);
+	CHECK_MESSAGE(Transform3D(first[0]).origin != Vector3(0, 0.6, 0), "Bodies should have moved.");
+
+	// Variant comparison of math types is exact, so any drift in the last bit fails.
+	for (int i = 0; i < first.size(); i++) {
+		CHECK_MESSAGE(first[i] == second[i], vformat("Value %d differs after changing object addresses.", i));
+		CHECK_MESSAGE(first[i] == third[i], vformat("Value %d differs between identical runs.", i));
+	}
+}
+
+TEST_CASE("[SceneTree][PhysicsServer2D] Deterministic step produces bit-identical results") {
+	ProjectSettings::get_singleton()->set_setting("physics/2d/solver/deterministic", true);
+
+	Vector<Variant> first = simulate_2d(false);
+	Vector<Variant> second = simulate_2d(true);
+	Vector<Variant> third = simulate_2d(false);
+
+	ProjectSettings::get_singleton()->set_setting("physics/2d/solver/deterministic", false);
+
+	REQUIRE(first.size() == BODY_COUNT * 3);
+	CHECK_MESSAGE(Transform2D(first[0]).get_origin() != Vector2(0, 20), "Bodies should have moved.");
+
+	for (int i = 0; i < first.size(); i++) {
+		CHECK_MESSAGE(first[i] == second[i], vformat("Value %d differs after changing object addresses.", i));
+		CHECK_MESSAGE(first[i] == third[i], vformat("Value %d differs between identical runs.", i));
+	}
+}
+
+} // namespace TestPhysicsDeterminism
+
+#endif // TEST_PHYSICS_DETERMINISM_H
@@ -0,0 +1,94 @@
+/*************************************************************************/
+/*  test_physics_narrowphase_cache.h                                     */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PHYSICS_NARROWPHASE_CACHE_H
+#define TEST_PHYSICS_NARROWPHASE_CACHE_H
+
+#include "servers/physics_server_3d.h"
+#include "tests/test_macros.h"
+
+namespace TestPhysicsNarrowphaseCache {
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Cached contacts follow bodies that rotate together") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	RID platform_shape = ps->box_shape_create();
+	ps->shape_set_data(platform_shape, Vector3(2, 0.25, 2));
+	RID platform = ps->body_create();
+	ps->body_set_mode(platform, PhysicsServer3D::BODY_MODE_KINEMATIC);
+	ps->body_set_space(platform, space);
+	ps->body_add_shape(platform, platform_shape);
+	ps->body_set_state(platform, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D());
+
+	// The box is carried by the platform, so the narrowphase between them can be skipped
+	// while the contacts reported for the box must still be tilted with the platform.
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+	RID box = ps->body_create();
+	ps->body_set_mode(box, PhysicsServer3D::BODY_MODE_KINEMATIC);
+	ps->body_set_space(box, space);
+	ps->body_add_shape(box, box_shape);
+	ps->body_set_max_contacts_reported(box, 4);
+	const Transform3D box_rest = Transform3D(Basis(), Vector3(0, 0.74, 0));
+	ps->body_set_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM, box_rest);
+
+	int cache_hits = 0;
+	for (int i = 1; i <= 40; i++) {
+		Transform3D tilt = Transform3D(Basis(Vector3(0, 0, 1), Math::deg_to_rad(0.5 * i)), Vector3());
+		ps->body_set_state(platform, PhysicsServer3D::BODY_STATE_TRANSFORM, tilt);
+		ps->body_set_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM, tilt * box_rest);
+		ps->step(1.0 / 60.0);
+		cache_hits += ps->get_process_info(PhysicsServer3D::INFO_NARROWPHASE_CACHE_HITS);
+
+		PhysicsDirectBodyState3D *state = ps->body_get_direct_state(box);
+		REQUIRE(state);
+		REQUIRE_MESSAGE(state->get_contact_count() > 0, vformat("The box should touch the platform at step %d.", i));
+
+		Transform3D platform_xform = ps->body_get_state(platform, PhysicsServer3D::BODY_STATE_TRANSFORM);
+		Vector3 up = platform_xform.basis.get_column(1).normalized();
+		for (int j = 0; j < state->get_contact_count(); j++) {
+			CHECK_MESSAGE(state->get_contact_local_normal(j).dot(up) > 0.99, vformat("Contact %d should face away from the platform at step %d.", j, i));
+		}
+	}
+	CHECK_MESSAGE(cache_hits > 0, "The narrowphase should have been skipped while the bodies moved together.");
+
+	ps->free(box);
+	ps->free(platform);
+	ps->free(box_shape);
+	ps->free(platform_shape);
+	ps->free(space);
+}
+
+} // namespace TestPhysicsNarrowphaseCache
+
+#endif // TEST_PHYSICS_NARROWPHASE_CACHE_H
@@ -0,0 +1,362 @@
+/*************************************************************************/
+/*  test_physics_queries.h                                               */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PHYSICS_QUERIES_H
+#define TEST_PHYSICS_QUERIES_H
+
+#include "servers/physics_server_2d.h"
+#include "servers/physics_server_3d.h"
+#include "tests/test_macros.h"
+
+namespace TestPhysicsQueries {
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Batched queries match single queries") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	// A row of boxes with gaps, so some rays hit and some miss.
+	Vector<RID> bodies;
+	for (int i = 0; i < 10; i++) {
+		RID body = ps->body_create();
+		ps->body_set_mode(body, PhysicsServer3D::BODY_MODE_STATIC);
+		ps->body_set_space(body, space);
+		ps->body_add_shape(body, box_shape);
+		ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(i * 2.0, 0, 0)));
+		bodies.push_back(body);
+	}
+
+	// Lets the space pick up the new shapes.
+	ps->step(1.0 / 60.0);
+
+	PhysicsDirectSpaceState3D *state = ps->space_get_direct_state(space);
+	REQUIRE(state);
+
+	const int query_count = 200;
+	Vector<Vector3> from;
+	Vector<Vector3> to;
+	Vector<Transform3D> transforms;
+	for (int i = 0; i < query_count; i++) {
+		real_t x = i * 0.1;
+		from.push_back(Vector3(x, 5, (i % 3) * 0.2));
+		to.push_back(Vector3(x, -5, (i % 3) * 0.2));
+		transforms.push_back(Transform3D(Basis(), Vector3(x, 0.9, 0)));
+	}
+
+	SUBCASE("Rays") {
+		PhysicsDirectSpaceState3D::RayParameters parameters;
+		Vector<PhysicsDirectSpaceState3D::RayResult> results;
+		results.resize(query_count);
+		Vector<bool> hits;
+		hits.resize(query_count);
+		state->intersect_rays(parameters, from.ptr(), to.ptr(), query_count, results.ptrw(), hits.ptrw());
+
+		int hit_count = 0;
+		for (int i = 0; i < query_count; i++) {
+			parameters.from = from[i];
+			parameters.to = to[i];
+			PhysicsDirectSpaceState3D::RayResult expected;
+			bool hit = state->intersect_ray(parameters, expected);
+
+			CHECK(hits[i] == hit);
+			if (hit && hits[i]) {
+				CHECK(results[i].rid == expected.rid);
+				CHECK(results[i].shape == expected.shape);
+				CHECK(results[i].position == expected.position);
+				CHECK(results[i].normal == expected.normal);
+				hit_count++;
+			}
+		}
+		CHECK(hit_count > 0);
+		CHECK(hit_count < query_count);
+	}
+
+	SUBCASE("Shapes") {
+		RID probe_shape = ps->sphere_shape_create();
+		ps->shape_set_data(probe_shape, 0.5);
+
+		PhysicsDirectSpaceState3D::ShapeParameters parameters;
+		parameters.shape_rid = probe_shape;
+
+		const int result_max = 4;
+		Vector<PhysicsDirectSpaceState3D::ShapeResult> results;
+		results.resize(query_count * result_max);
+		Vector<int> counts;
+		counts.resize(query_count);
+		state->intersect_shapes(parameters, transforms.ptr(), query_count, results.ptrw(), result_max, counts.ptrw());
+
+		for (int i = 0; i < query_count; i++) {
+			parameters.transform = transforms[i];
+			PhysicsDirectSpaceState3D::ShapeResult expected[result_max];
+			int expected_count = state->intersect_shape(parameters, expected, result_max);
+
+			REQUIRE(counts[i] == expected_count);
+			for (int j = 0; j < expected_count; j++) {
+				CHECK(results[i * result_max + j].rid == expected[j].rid);
+			}
+		}
+
+		ps->free(probe_shape);
+	}
+
+	SUBCASE("Shapes with an invalid shape") {
+		PhysicsDirectSpaceState3D::ShapeParameters parameters;
+		parameters.shape_rid = RID();
+
+		const int result_max = 4;
+		Vector<PhysicsDirectSpaceState3D::ShapeResult> results;
+		results.resize(query_count * result_max);
+		Vector<int> counts;
+		counts.resize(query_count);
+		counts.fill(-1);
+
+		ERR_PRINT_OFF;
+		state->intersect_shapes(parameters, transforms.ptr(), query_count, results.ptrw(), result_max, counts.ptrw());
+		ERR_PRINT_ON;
+		for (int i = 0; i < query_count; i++) {
+			CHECK(counts[i] == 0);
+		}
+
+		// The scripting binding must not read past the results either.
+		Ref<PhysicsShapeQueryParameters3D> query;
+		query.instantiate();
+		PackedVector3Array positions;
+		for (int i = 0; i < query_count; i++) {
+			positions.push_back(transforms[i].origin);
+		}
+		ERR_PRINT_OFF;
+		Dictionary d = state->call("intersect_shapes", query, positions, result_max);
+		ERR_PRINT_ON;
+		PackedInt32Array bound_counts = d["count"];
+		REQUIRE(bound_counts.size() == query_count);
+		for (int i = 0; i < query_count; i++) {
+			CHECK(bound_counts[i] == 0);
+		}
+		CHECK(PackedInt32Array(d["shape"]).is_empty());
+	}
+
+	for (int i = 0; i < bodies.size(); i++) {
+		ps->free(bodies[i]);
+	}
+	ps->free(box_shape);
+	ps->free(space);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Queries against concave shapes and heightmaps") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+
+	// The same sloped terrain as a triangle mesh and as a heightmap, so both
+	// acceleration structures can be checked against a known surface. The heightmap
+	// is large enough to get coarser bounds levels above its chunk grid.
+	const int size = 65;
+	const real_t half = (size - 1) * 0.5;
+	const real_t slope = 0.25;
+
+	Vector<real_t> heights;
+	heights.resize(size * size);
+	for (int z = 0; z < size; z++) {
+		for (int x = 0; x < size; x++) {
+			heights.write[z * size + x] = (x - half) * slope;
+		}
+	}
+
+	PackedVector3Array faces;
+	for (int z = 0; z < size - 1; z++) {
+		for (int x = 0; x < size - 1; x++) {
+			Vector3 a(x - half, (x - half) * slope, z - half);
+			Vector3 b(x + 1 - half, (x + 1 - half) * slope, z - half);
+			Vector3 c(x - half, (x - half) * slope, z + 1 - half);
+			Vector3 d(x + 1 - half, (x + 1 - half) * slope, z + 1 - half);
+			faces.push_back(a);
+			faces.push_back(b);
+			faces.push_back(c);
+			faces.push_back(b);
+			faces.push_back(d);
+			faces.push_back(c);
+		}
+	}
+
+	RID concave_shape = ps->concave_polygon_shape_create();
+	Dictionary concave_data;
+	concave_data["faces"] = faces;
+	concave_data["backface_collision"] = false;
+	ps->shape_set_data(concave_shape, concave_data);
+
+	RID heightmap_shape = ps->heightmap_shape_create();
+	Dictionary heightmap_data;
+	heightmap_data["width"] = size;
+	heightmap_data["depth"] = size;
+	heightmap_data["heights"] = heights;
+	ps->shape_set_data(heightmap_shape, heightmap_data);
+
+	RID probe_shape = ps->sphere_shape_create();
+	ps->shape_set_data(probe_shape, 0.4);
+
+	// Spans the lower half of the terrain, which the coarser levels cover with a single range.
+	RID wide_probe_shape = ps->box_shape_create();
+	ps->shape_set_data(wide_probe_shape, Vector3(15, 0.5, 30));
+	const real_t wide_probe_x = -half * 0.5;
+
+	RID shapes[2] = { concave_shape, heightmap_shape };
+	for (int s = 0; s < 2; s++) {
+		RID space = ps->space_create();
+		ps->space_set_active(space, true);
+
+		RID body = ps->body_create();
+		ps->body_set_mode(body, PhysicsServer3D::BODY_MODE_STATIC);
+		ps->body_set_space(body, space);
+		ps->body_add_shape(body, shapes[s]);
+
+		ps->step(1.0 / 60.0);
+
+		PhysicsDirectSpaceState3D *state = ps->space_get_direct_state(space);
+		REQUIRE(state);
+
+		for (real_t x = -31.7; x < 31.7; x += 2.9) {
+			for (real_t z = -31.3; z < 31.3; z += 4.3) {
+				real_t ground = x * slope;
+
+				PhysicsDirectSpaceState3D::RayParameters ray_parameters;
+				ray_parameters.from = Vector3(x, 20, z);
+				ray_parameters.to = Vector3(x, -20, z);
+				PhysicsDirectSpaceState3D::RayResult ray_result;
+				REQUIRE(state->intersect_ray(ray_parameters, ray_result));
+				CHECK(ray_result.position.is_equal_approx(Vector3(x, ground, z)));
+
+				PhysicsDirectSpaceState3D::ShapeParameters shape_parameters;
+				shape_parameters.shape_rid = probe_shape;
+				PhysicsDirectSpaceState3D::ShapeResult shape_results[1];
+
+				shape_parameters.transform = Transform3D(Basis(), Vector3(x, ground + 0.2, z));
+				CHECK(state->intersect_shape(shape_parameters, shape_results, 1) == 1);
+
+				shape_parameters.transform = Transform3D(Basis(), Vector3(x, ground + 1.0, z));
+				CHECK(state->intersect_shape(shape_parameters, shape_results, 1) == 0);
+			}
+		}
+
+		// Above the lower half of the terrain, but below the highest point of the whole terrain.
+		PhysicsDirectSpaceState3D::ShapeParameters wide_parameters;
+		wide_parameters.shape_rid = wide_probe_shape;
+		PhysicsDirectSpaceState3D::ShapeResult wide_results[1];
+		wide_parameters.transform = Transform3D(Basis(), Vector3(wide_probe_x, 1.5, 0));
+		CHECK(state->intersect_shape(wide_parameters, wide_results, 1) == 0);
+
+		// Crossing the lower half of the terrain, only found by descending to the cells.
+		wide_parameters.transform = Transform3D(Basis(), Vector3(wide_probe_x, -3, 0));
+		CHECK(state->intersect_shape(wide_parameters, wide_results, 1) == 1);
+
+		// Outside the terrain footprint nothing should be hit.
+		PhysicsDirectSpaceState3D::RayParameters ray_parameters;
+		ray_parameters.from = Vector3(half + 2, 20, 0);
+		ray_parameters.to = Vector3(half + 2, -20, 0);
+		PhysicsDirectSpaceState3D::RayResult ray_result;
+		CHECK_FALSE(state->intersect_ray(ray_parameters, ray_result));
+
+		ps->free(body);
+		ps->free(space);
+	}
+
+	ps->free(wide_probe_shape);
+	ps->free(probe_shape);
+	ps->free(heightmap_shape);
+	ps->free(concave_shape);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer2D] Batched queries match single queries") {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	RID box_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(box_shape, Vector2(8, 8));
+
+	Vector<RID> bodies;
+	for (int i = 0; i < 10; i++) {
+		RID body = ps->body_create();
+		ps->body_set_mode(body, PhysicsServer2D::BODY_MODE_STATIC);
+		ps->body_set_space(body, space);
+		ps->body_add_shape(body, box_shape);
+		ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, Vector2(i * 32.0, 0)));
+		bodies.push_back(body);
+	}
+
+	ps->step(1.0 / 60.0);
+
+	PhysicsDirectSpaceState2D *state = ps->space_get_direct_state(space);
+	REQUIRE(state);
+
+	const int query_count = 200;
+	Vector<Vector2> from;
+	Vector<Vector2> to;
+	for (int i = 0; i < query_count; i++) {
+		from.push_back(Vector2(i * 1.6, -100));
+		to.push_back(Vector2(i * 1.6, 100));
+	}
+
+	PhysicsDirectSpaceState2D::RayParameters parameters;
+	Vector<PhysicsDirectSpaceState2D::RayResult> results;
+	results.resize(query_count);
+	Vector<bool> hits;
+	hits.resize(query_count);
+	state->intersect_rays(parameters, from.ptr(), to.ptr(), query_count, results.ptrw(), hits.ptrw());
+
+	int hit_count = 0;
+	for (int i = 0; i < query_count; i++) {
+		parameters.from = from[i];
+		parameters.to = to[i];
+		PhysicsDirectSpaceState2D::RayResult expected;
+		bool hit = state->intersect_ray(parameters, expected);
+
+		CHECK(hits[i] == hit);
+		if (hit && hits[i]) {
+			CHECK(results[i].rid == expected.rid);
+			CHECK(results[i].position == expected.position);
+			hit_count++;
+		}
+	}
+	CHECK(hit_count > 0);
+	CHECK(hit_count < query_count);
+
+	for (int i = 0; i < bodies.size(); i++) {
+		ps->free(bodies[i]);
+	}
+	ps->free(box_shape);
+	ps->free(space);
+}
+
+} // namespace TestPhysicsQueries
+
+#endif // TEST_PHYSICS_QUERIES_H
@@ -0,0 +1,95 @@
+/*************************************************************************/
+/*  test_physics_sleeping.h                                              */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PHYSICS_SLEEPING_H
+#define TEST_PHYSICS_SLEEPING_H
+
+#include "servers/physics_server_3d.h"
+#include "tests/test_macros.h"
+
+namespace TestPhysicsSleeping {
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Islands fall asleep and wake up as a whole") {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+
+	RID floor_shape = ps->world_boundary_shape_create();
+	ps->shape_set_data(floor_shape, Plane(Vector3(0, 1, 0), 0));
+	RID floor = ps->body_create();
+	ps->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	ps->body_set_space(floor, space);
+	ps->body_add_shape(floor, floor_shape);
+
+	RID box_shape = ps->box_shape_create();
+	ps->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	// A stack of boxes resting on each other, which forms a single island.
+	const int stack_size = 3;
+	RID stack[stack_size];
+	for (int i = 0; i < stack_size; i++) {
+		stack[i] = ps->body_create();
+		ps->body_set_space(stack[i], space);
+		ps->body_add_shape(stack[i], box_shape);
+		ps->body_set_state(stack[i], PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, 0.5 + i, 0)));
+	}
+
+	for (int i = 0; i < 120; i++) {
+		ps->step(1.0 / 60.0);
+	}
+
+	for (int i = 0; i < stack_size; i++) {
+		CHECK_MESSAGE(bool(ps->body_get_state(stack[i], PhysicsServer3D::BODY_STATE_SLEEPING)), vformat("Body %d should be sleeping.", i));
+	}
+	CHECK(ps->get_process_info(PhysicsServer3D::INFO_SLEEPING_OBJECTS) == stack_size);
+	CHECK(ps->get_process_info(PhysicsServer3D::INFO_ACTIVE_OBJECTS) == 0);
+
+	// Waking up the top box wakes up the boxes it rests on right away.
+	ps->body_set_state(stack[stack_size - 1], PhysicsServer3D::BODY_STATE_SLEEPING, false);
+	for (int i = 0; i < stack_size; i++) {
+		CHECK_FALSE_MESSAGE(bool(ps->body_get_state(stack[i], PhysicsServer3D::BODY_STATE_SLEEPING)), vformat("Body %d should have been woken up.", i));
+	}
+
+	ps->step(1.0 / 60.0);
+	CHECK(ps->get_process_info(PhysicsServer3D::INFO_SLEEPING_OBJECTS) == 0);
+
+	for (int i = 0; i < stack_size; i++) {
+		ps->free(stack[i]);
+	}
+	ps->free(floor);
+	ps->free(box_shape);
+	ps->free(floor_shape);
+	ps->free(space);
+}
+
+} // namespace TestPhysicsSleeping
+
+#endif // TEST_PHYSICS_SLEEPING_H
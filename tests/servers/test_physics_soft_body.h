@@ -0,0 +1,157 @@
+/*************************************************************************/
+/*  test_physics_soft_body.h                                             */
+/*************************************************************************/
+/*                       This file is part of:                           */
+/*                           GODOT ENGINE                                */
+/*                      https://godotengine.org                          */
+/*************************************************************************/
+/* Copyright (c) 2007-2022 Juan Linietsky, Ariel Manzur.                 */
+/* Copyright (c) 2014-2022 Godot Engine contributors (cf. AUTHORS.md).   */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_PHYSICS_SOFT_BODY_H
+#define TEST_PHYSICS_SOFT_BODY_H
+
+#include "servers/physics_3d/godot_soft_body_3d.h"
+#include "servers/rendering_server.h"
+#include "tests/test_macros.h"
+
+namespace TestPhysicsSoftBody {
+
+// A square cloth made of size * size vertices, large enough for its link batches to be split over threads.
+static RID create_cloth_mesh(int p_size) {
+	PackedVector3Array vertices;
+	for (int y = 0; y < p_size; y++) {
+		for (int x = 0; x < p_size; x++) {
+			vertices.push_back(Vector3(x * 0.1, 0, y * 0.1));
+		}
+	}
+
+	PackedInt32Array indices;
+	for (int y = 0; y < p_size - 1; y++) {
+		for (int x = 0; x < p_size - 1; x++) {
+			int i = y * p_size + x;
+			indices.push_back(i);
+			indices.push_back(i + 1);
+			indices.push_back(i + p_size);
+			indices.push_back(i + 1);
+			indices.push_back(i + p_size + 1);
+			indices.push_back(i + p_size);
+		}
+	}
+
+	Array arrays;
+	arrays.resize(RS::ARRAY_MAX);
+	arrays[RS::ARRAY_VERTEX] = vertices;
+	arrays[RS::ARRAY_INDEX] = indices;
+
+	RID mesh = RS::get_singleton()->mesh_create();
+	RS::get_singleton()->mesh_add_surface_from_arrays(mesh, RS::PRIMITIVE_TRIANGLES, arrays);
+	return mesh;
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Soft body link batches share no node") {
+	RID mesh = create_cloth_mesh(40);
+	GodotSoftBody3D *soft_body = memnew(GodotSoftBody3D);
+	soft_body->set_mesh(mesh);
+	REQUIRE(soft_body->get_node_count() == 40 * 40);
+
+	uint32_t link_count = 0;
+	uint32_t largest_batch = 0;
+	for (uint32_t batch = 0; batch < soft_body->get_link_batch_count(); batch++) {
+		uint32_t begin = 0;
+		uint32_t count = 0;
+		bool independent = false;
+		soft_body->get_link_batch(batch, begin, count, independent);
+		CHECK(begin == link_count);
+		link_count += count;
+		largest_batch = MAX(largest_batch, count);
+		if (!independent) {
+			continue;
+		}
+
+		HashSet<uint32_t> batch_nodes;
+		bool shared = false;
+		for (uint32_t link = begin; link < begin + count; link++) {
+			uint32_t node_a = 0;
+			uint32_t node_b = 0;
+			soft_body->get_link_nodes(link, node_a, node_b);
+			shared = shared || batch_nodes.has(node_a) || batch_nodes.has(node_b);
+			batch_nodes.insert(node_a);
+			batch_nodes.insert(node_b);
+		}
+		CHECK_FALSE_MESSAGE(shared, vformat("Links of batch %d share a node.", batch));
+	}
+	CHECK(link_count == soft_body->get_link_count());
+	CHECK(largest_batch > 512);
+
+	memdelete(soft_body);
+	RS::get_singleton()->free(mesh);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Soft body constraints give the same result with and without threads") {
+	RID mesh = create_cloth_mesh(40);
+	GodotSoftBody3D *soft_bodies[2];
+	for (int i = 0; i < 2; i++) {
+		soft_bodies[i] = memnew(GodotSoftBody3D);
+		soft_bodies[i]->set_mesh(mesh);
+
+		// Stretched, so every link has to pull its nodes back. Set twice to also move the previous positions.
+		for (int v = 0; v < 40 * 40; v++) {
+			Vector3 position = soft_bodies[i]->get_vertex_position(v) * 1.3;
+			soft_bodies[i]->set_vertex_position(v, position);
+			soft_bodies[i]->set_vertex_position(v, position);
+		}
+	}
+
+	LocalVector<Vector3> stretched_positions;
+	for (uint32_t i = 0; i < soft_bodies[0]->get_node_count(); i++) {
+		stretched_positions.push_back(soft_bodies[0]->get_node_position(i));
+	}
+
+	for (int step = 0; step < 10; step++) {
+		soft_bodies[0]->solve_constraints(1.0 / 60.0, true);
+		soft_bodies[1]->solve_constraints(1.0 / 60.0, false);
+	}
+
+	int mismatches = 0;
+	int moved = 0;
+	for (uint32_t i = 0; i < soft_bodies[0]->get_node_count(); i++) {
+		if (soft_bodies[0]->get_node_position(i) != soft_bodies[1]->get_node_position(i)) {
+			mismatches++;
+		}
+		if (soft_bodies[0]->get_node_position(i) != stretched_positions[i]) {
+			moved++;
+		}
+	}
+	CHECK(mismatches == 0);
+	CHECK(moved > 0);
+
+	for (int i = 0; i < 2; i++) {
+		memdelete(soft_bodies[i]);
+	}
+	RS::get_singleton()->free(mesh);
+}
+
+} // namespace TestPhysicsSoftBody
+
+#endif // TEST_PHYSICS_SOFT_BODY_H
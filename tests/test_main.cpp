@@ -63,6 +63,7 @@
 #include "tests/core/math/test_vector4.h"
 #include "tests/core/math/test_vector4i.h"
 #include "tests/core/object/test_class_db.h"
+#include "tests/core/object/test_message_queue.h"
 #include "tests/core/object/test_method_bind.h"
 #include "tests/core/object/test_object.h"
 #include "tests/core/os/test_os.h"
@@ -92,6 +93,8 @@
 #include "tests/scene/test_code_edit.h"
 #include "tests/scene/test_curve.h"
 #include "tests/scene/test_gradient.h"
+#include "tests/scene/test_node.h"
+#include "tests/scene/test_node_3d.h"
 #include "tests/scene/test_path_2d.h"
 #include "tests/scene/test_path_3d.h"
 #include "tests/scene/test_primitives.h"
@@ -99,6 +102,13 @@
 #include "tests/scene/test_text_edit.h"
 #include "tests/scene/test_theme.h"
 #include "tests/scene/test_visual_shader.h"
+#include "tests/servers/test_physics_area_monitor.h"
+#include "tests/servers/test_physics_ccd.h"
+#include "tests/servers/test_physics_determinism.h"
+#include "tests/servers/test_physics_narrowphase_cache.h"
+#include "tests/servers/test_physics_queries.h"
+#include "tests/servers/test_physics_sleeping.h"
+#include "tests/servers/test_physics_soft_body.h"
 #include "tests/servers/test_text_server.h"
 #include "tests/test_validate_testing.h"
 